@@ -0,0 +1,165 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers.hpp"
+
+/**
+ * Creates an empty clipboard.
+ * @param file_name The name of the temporary file that stores data that is too large for the memory.
+ * @param memory_size The maximum size (in bytes) of the data that is held in memory.
+ */
+TClipboard::TClipboard(const char* file_name, int64_t memory_size)
+    : file_name_(file_name),
+    memory_size_(memory_size),
+    length_(0),
+    data_(),
+    file_(nullptr)
+{
+}
+
+/**
+ * Drops the current data and prepares the clipboard for new data of the specified length. The data is always stored
+ * in the temporary file (so that another instance can paste it) and additionally held in memory (if not larger than
+ * the memory size). The data is stored by Store().
+ * @param length The length of the new data.
+ * @return true on success, false otherwise (the clipboard is empty then).
+ */
+bool TClipboard::Prepare(int64_t length) noexcept
+{
+    // Drop the current data
+    this->Clear();
+    if (length < 0) return false;
+
+    // Hold the data in memory as well, if possible
+    if (length <= this->memory_size_)
+    {
+        try
+        {
+            this->data_.resize(static_cast<std::size_t>(length));
+        }
+        catch (const std::bad_alloc&)
+        {
+            return false;
+        }
+    }
+
+    // Create the temporary file (it is not mapped, another instance may truncate it at any time)
+    this->file_.reset(new (std::nothrow) TFile(this->file_name_, false));
+    if ((!this->file_) || (!this->file_->Open(TFileMode::CREATE)))
+    {
+        this->Clear();
+        return false;
+    }
+    this->length_ = length;
+    return true;
+}
+
+/**
+ * Stores the specified range of the specified file at the specified offset of the clipboard data.
+ * @param source The file to copy the data from.
+ * @param position The zero-based position of the data within the source file.
+ * @param length The number of bytes to store.
+ * @param offset The offset within the clipboard data (the data must fit into the prepared length).
+ * @return The number of bytes stored.
+ */
+int64_t TClipboard::Store(TFile* source, int64_t position, int64_t length, int64_t offset) noexcept
+{
+    // Ensure the data fits
+    if ((offset < 0) || (length < 0) || (offset + length > this->length_)) return 0;
+
+    // Copy the data into the temporary file only (within the kernel, if possible)
+    if (!this->IsInMemory()) return source->CopyTo(this->file_.get(), position, length, offset);
+
+    // Copy the data into the memory and write it to the temporary file
+    int64_t bytes_stored = 0;
+    while (bytes_stored < length)
+    {
+        const auto count = static_cast<uint32_t>(hedit_min(length - bytes_stored, static_cast<int64_t>(HE_FILE_SAVE_BLOCK_SIZE)));
+        const auto block = &this->data_[static_cast<std::size_t>(offset + bytes_stored)];
+        const auto bytes_read = source->ReadAt(block, count, position + bytes_stored);
+        const auto bytes_written = this->file_->WriteAt(block, bytes_read, offset + bytes_stored);
+        bytes_stored += bytes_written;
+        if ((bytes_read < count) || (bytes_written < bytes_read)) break;
+    }
+    return bytes_stored;
+}
+
+/**
+ * Completes the storing of the data. The temporary file is closed if the data is held in memory, otherwise it is
+ * reopened for reading (the data is read via copies, see TFile::Peek()).
+ * @return true on success, false otherwise (the clipboard is empty then).
+ */
+bool TClipboard::Complete() noexcept
+{
+    // Ensure the data is written to the temporary file
+    if ((!this->file_) || (!this->file_->Flush()))
+    {
+        this->Clear();
+        return false;
+    }
+
+    // Close the temporary file, if the data is held in memory
+    if (this->IsInMemory())
+    {
+        this->file_.reset();
+        return true;
+    }
+
+    // Reopen the temporary file for reading
+    if (!this->file_->Open(TFileMode::READ))
+    {
+        this->Clear();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Drops the data. The temporary file is closed, but not deleted (it may be used by another instance).
+ */
+void TClipboard::Clear() noexcept
+{
+    this->data_.clear();
+    this->data_.shrink_to_fit();
+    this->file_.reset();
+    this->length_ = 0;
+}
+
+/**
+ * Returns a pointer to the data at the specified offset (in memory, or a copy read from the temporary file, see TFile::Peek()).
+ * The pointer is valid until the clipboard is changed or peeked again.
+ * @param offset The offset within the clipboard data.
+ * @param length The number of bytes that are requested.
+ * @param available Receives the number of bytes that are available at the pointer.
+ * @return The pointer to the data or nullptr if the data is not available.
+ */
+const unsigned char* TClipboard::Peek(int64_t offset, uint32_t length, uint32_t& available) noexcept
+{
+    // Ensure valid data
+    available = 0;
+    if ((offset < 0) || (offset >= this->length_) || (length == 0)) return nullptr;
+
+    // Read from the temporary file
+    if (!this->IsInMemory()) return this->file_->Peek(offset, static_cast<uint32_t>(hedit_min(static_cast<int64_t>(length), this->length_ - offset)), available);
+
+    // Refer to the memory
+    available = static_cast<uint32_t>(hedit_min(static_cast<int64_t>(length), this->length_ - offset));
+    return &this->data_[static_cast<std::size_t>(offset)];
+}
+
+/**
+ * Returns the length of the data.
+ * @return The length of the data (0 if the clipboard is empty).
+ */
+int64_t TClipboard::Length() const noexcept
+{
+    return this->length_;
+}
+
+/**
+ * Returns true if the data is held in memory, false if it is read from the temporary file (or if the clipboard is empty).
+ * @return true if the data is held in memory, false otherwise.
+ */
+bool TClipboard::IsInMemory() const noexcept
+{
+    return ((this->length_ > 0) && (this->length_ <= this->memory_size_));
+}
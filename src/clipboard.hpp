@@ -0,0 +1,42 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#ifndef HEDIT_SRC_CLIPBOARD_HPP_
+
+    // Header included
+    #define HEDIT_SRC_CLIPBOARD_HPP_
+
+    // The default memory size of the clipboard
+    constexpr int32_t HE_CLIPBOARD_DEFAULT_SIZE = 65536;  //!< The default size (in KiB) of the data that is held in memory (larger data is stored in the temporary file).
+
+    /**
+     * @brief The clipboard that holds the data of the copy/paste operations.
+     * @details The data is always stored in the temporary file, so that another instance can paste it. Data up to
+     * the configured size is held in memory as well, so that pasting it is a single copy. Larger data is copied into
+     * the temporary file (within the kernel, if possible, see TFile::CopyTo()) and read from there block by block
+     * (not via a memory mapping: another instance may truncate the file at any time). The data is stored by Prepare(),
+     * Store() and Complete(), and read by Peek().
+     */
+    class TClipboard
+    {
+    private:
+        TString file_name_;                 //!< The name of the temporary file for large data.
+        int64_t memory_size_;               //!< The maximum size (in bytes) of the data that is held in memory.
+        int64_t length_;                    //!< The length of the data (0 if empty).
+        std::vector<unsigned char> data_;   //!< The data, if held in memory.
+        std::unique_ptr<TFile> file_;       //!< The temporary file (while the data is stored, or if the data is not held in memory).
+    public:
+        TClipboard(const char* file_name, int64_t memory_size);
+        TClipboard(const TClipboard& source) = delete;
+        TClipboard& operator=(const TClipboard& source) = delete;
+        TClipboard(TClipboard&&) = delete;
+        TClipboard& operator=(TClipboard&&) = delete;
+        bool Prepare(int64_t length) noexcept;
+        int64_t Store(TFile* source, int64_t position, int64_t length, int64_t offset) noexcept;
+        bool Complete() noexcept;
+        void Clear() noexcept;
+        const unsigned char* Peek(int64_t offset, uint32_t length, uint32_t& available) noexcept;
+        int64_t Length() const noexcept;
+        bool IsInMemory() const noexcept;
+    };
+
+#endif  // HEDIT_SRC_CLIPBOARD_HPP_
@@ -1,419 +1,2988 @@
-// Copyright (c) 2021 Roxxorfreak
-
-#include "headers.hpp"
-
-/**
- * Creates a new file instance initializing the buffer for the cache (if the
- * file uses caching) and assigns a file name.
- * @param file_name The name of the file to manage.
- * @param use_cache true to use caching, false to do not.
- */
-TFile::TFile(const char* file_name, bool use_cache)
-    : file_buffer_(nullptr),
-    cache_start_(0),
-    cache_length_(0),
-    file_cursor_(0),
-    file_handle_(nullptr),
-    file_name_(nullptr),
-    file_attribute_(TFileAttribute::NORMAL)
-{
-    // If caching is to be used, allocate memory for the cache
-    this->use_cache_ = use_cache;
-    if (this->use_cache_)
-    {
-        this->file_buffer_ = new unsigned char[HE_FILE_CACHE_SIZE];
-    }
-
-    // Store file name for later use
-    this->file_name_ = file_name;
-}
-
-/**
- * Destructor, frees the cache buffer and closes the associated file.
- */
-TFile::~TFile()
-{
-    // Check if a cache was allocate
-    if (this->file_buffer_ != nullptr)
-    {
-        // Free the file cache
-        delete[] this->file_buffer_;
-
-        // Clear the cache handle
-        this->file_buffer_ = nullptr;
-    }
-
-    // Close the file
-    this->Close();
-}
-
-/**
- * Tries to open the file, setting the internal file attribute to
- * TFileAttribute::ACCESS_DENIED if the file cannot be openend for any reason.
- * @param mode The file mode to use for opening (see TFileMode).
- * @return true on success, false otherwise.
- */
-bool TFile::Open(TFileMode mode) noexcept
-{
-    // Close any open files
-    this->Close();
-
-    // Reset cache
-    this->cache_start_ = 0;
-    this->cache_length_ = 0;
-    this->file_cursor_ = 0;
-
-    // Attempt to open the file in the specified mode
-    if (mode == TFileMode::READ)
-    {
-        #if defined(WIN32) && !defined(__BORLANDC__)
-        this->file_handle_ = _fsopen(this->file_name_, "rb", _SH_DENYNO);
-        #else
-        this->file_handle_ = fopen(this->file_name_, "rb");
-        #endif
-        this->file_attribute_ = TFileAttribute::READ_ONLY;
-    }
-    else if (mode == TFileMode::READWRITE)
-    {
-        #if defined(WIN32) && !defined(__BORLANDC__)
-        this->file_handle_ = _fsopen(this->file_name_, "r+b", _SH_DENYNO);
-        #else
-        this->file_handle_ = fopen(this->file_name_, "r+b");
-        #endif
-        this->file_attribute_ = TFileAttribute::NORMAL;
-    }
-    else if (mode == TFileMode::CREATE)
-    {
-        #if defined(WIN32) && !defined(__BORLANDC__)
-        this->file_handle_ = _fsopen(this->file_name_, "w+b", _SH_DENYNO);
-        #else
-        this->file_handle_ = fopen(this->file_name_, "w+b");
-        #endif
-        this->file_attribute_ = TFileAttribute::NORMAL;
-    }
-
-    if (this->file_handle_ != nullptr)
-    {
-        // Valid file handle
-        return true;
-    }
-    else
-    {
-        // Invalid file handle, report as "File access denied"
-        this->file_attribute_ = TFileAttribute::ACCESS_DENIED;
-        return false;
-    }
-}
-
-/**
- * Closes the associated file, if open, an clears the internal cache.
- */
-void TFile::Close() noexcept
-{
-    // Ensure a valid file handle
-    if (file_handle_ == nullptr) return;
-
-    // Close the file
-    fclose(file_handle_);
-
-    // Clear the file handle
-    this->file_handle_ = nullptr;
-
-    // Clear the cache, if any
-    if (this->file_buffer_ != nullptr) memset(this->file_buffer_, 0, HE_FILE_CACHE_SIZE);
-}
-
-/**
- * Reads the specified number of bytes from the current position in the file into the specified buffer.
- * @param buffer The buffer to read the data into.
- * @param length The size of the buffer (in bytes).
- * @return The number of bytes read from the file.
- */
-uint32_t TFile::Read(unsigned char* buffer, uint32_t length) noexcept
-{
-    // Clear the buffer
-    memset(buffer, 0, length);
-
-    // Check, if file opened
-    if (this->file_handle_ == nullptr) return 0;
-
-    // Check if to read from file cache
-    if (this->use_cache_ == false)
-    {
-        // Cache disabled, read from file
-        return fread(buffer, 1, length, this->file_handle_);
-    }
-
-    // Read from cache
-    const auto bytes_read = this->ReadFromCache(buffer, length);
-    if (bytes_read == 0) return 0;
-
-    // Advance position in file
-    this->file_cursor_ += bytes_read;
-
-    // Return number of bytes read from the file
-    return bytes_read;
-}
-
-/**
- * Reads the specified number of bytes from the specified position in the file into the specified buffer.
- * @param buffer The buffer to read the data into.
- * @param length The size of the buffer (in bytes).
- * @param position The zero-based position to read at.
- * @return The number of bytes read from the file.
- */
-uint32_t TFile::ReadAt(unsigned char* buffer, uint32_t length, int64_t position) noexcept
-{
-    // Try to set file pointer position
-    if (this->Seek(position) == false) return 0;
-
-    // Try to read there
-    return this->Read(buffer, length);
-}
-
-/**
- * Writes the specified number of bytes from the specified buffer into the file at the current position.
- * @param buffer The buffer with the data.
- * @param length The number of bytes to write.
- * @return The number of bytes written.
- */
-uint32_t TFile::Write(const unsigned char* buffer, uint32_t length) noexcept
-{
-    // Check, if file opened
-    if (this->file_handle_ == nullptr) return 0;
-
-    // If caching is enabled, position the file cursor on the correct position
-    if (use_cache_ == true)
-    {
-        _fseeki64(this->file_handle_, this->file_cursor_, SEEK_SET);
-    }
-
-    // Writes go always directly to the file
-    const auto bytes_written = fwrite(buffer, 1, length, this->file_handle_);
-
-    // Flush the stream
-    fflush(this->file_handle_);
-
-    // Ensure the bytes were written
-    if (bytes_written == 0) return 0;
-
-    // Assign the
-    this->file_cursor_ += bytes_written;
-
-    // Refresh the cache (if caching is used)
-    if (this->use_cache_) this->ReadIntoCache();
-
-    // Return the number of bytes written
-    return bytes_written;
-}
-
-/**
- * Writes the specified number of bytes from the specified buffer into the file at the the specified position.
- * @param buffer The buffer with the data.
- * @param length The number of bytes to write.
- * @param position The zero-based position to write at.
- * @return The number of bytes written.
- */
-uint32_t TFile::WriteAt(const unsigned char* buffer, uint32_t length, int64_t position) noexcept
-{
-    // Try to set file pointer position
-    if (this->Seek(position) == false) return 0;
-
-    // Try to write there
-    return this->Write(buffer, length);
-}
-
-/**
- * Positions the file cursor.
- * @param position The new absolute position of the file pointer (zero-based).
- * @return true on success, false otherwise.
- */
-bool TFile::Seek(int64_t position) noexcept
-{
-    // Check, if file opened
-    if (this->file_handle_ == nullptr) return false;
-
-    // Ensure a valid (positive) position
-    if (position < 0) return false;
-
-    // Check if caching is used
-    if (this->use_cache_)
-    {
-        // Set the position of the virtual file pointer
-        this->file_cursor_ = position;
-
-        // Always return success
-        return true;
-    }
-    else
-    {
-        // Set the position of the real file pointer
-        if (_fseeki64(this->file_handle_, position, SEEK_SET) < 0) return false;
-
-        // Return success
-        return true;
-    }
-}
-
-/**
- * Reads one line of text from the current position in the file.
- * If no data can be read, an empty string object is returned.
- * @return A string with the read line.
- */
-TString TFile::ReadLine()
-{
-    TString buffer;
-    unsigned char tempbuffer[2];
-
-    // Initialize the temporary buffer
-    tempbuffer[1] = 0;
-
-    // Process the whole file
-    while (!this->IsEOF())
-    {
-        // Read one byte
-        if (this->Read(tempbuffer, 1) < 1) continue;
-
-        // Skip CR
-        if (tempbuffer[0] == 0x0D) continue;
-
-        // End with LF
-        if (tempbuffer[0] == 0x0A) break;
-
-        // Append the character
-        buffer += static_cast<char>(tempbuffer[0]);
-    }
-
-    // Return the string
-    return buffer;
-}
-
-/**
- * Returns true if end of file is reached, false otherwise.
- * @return true if end of file is reached, false otherwise.
- */
-bool TFile::IsEOF() noexcept
-{
-    // A closed file will be reported as as eof
-    if (this->file_handle_ == nullptr) return true;
-
-    if (this->use_cache_ == true)
-    {
-        return (this->file_cursor_ >= this->FileSize());
-    }
-    else
-    {
-        return (feof(this->file_handle_) != 0);
-    }
-}
-
-/**
- * Returns true if the file is read-only, false otherwise.
- * @return true if the file is read-only, false otherwise.
- */
-bool TFile::IsReadOnly() const noexcept
-{
-    return (this->file_attribute_ == TFileAttribute::READ_ONLY);
-}
-
-/**
- * Returns the size of the associated file. The file must be open, otherwise 0 is returned.
- * @return The size of the associated file.
- */
-int64_t TFile::FileSize() noexcept
-{
-    // Ensure the file is open
-    if (this->file_handle_ == nullptr) return 0;
-
-    // Remember the old file pos
-    const auto old_pos = _ftelli64(this->file_handle_);
-
-    // Jump to eof
-    _fseeki64(this->file_handle_, 0, SEEK_END);
-
-    // Retrieve current position, that equals to file length
-    const auto length = _ftelli64(this->file_handle_);
-
-    // Set old position
-    _fseeki64(this->file_handle_, old_pos, SEEK_SET);
-
-    // Return file size
-    return length;
-}
-
-/**
- * Fills the cache with data, starting at the current cache start position and reading HE_FILE_CACHE_SIZE bytes.
- * @return true on success, false otherwise.
- */
-bool TFile::ReadIntoCache() noexcept
-{
-    // Clear cache completely
-    memset(this->file_buffer_, 0, HE_FILE_CACHE_SIZE);
-
-    // Seek to the cache starting position
-    const auto return_value = _fseeki64(file_handle_, this->cache_start_, SEEK_SET);
-    if (return_value < 0)
-    {
-        this->cache_start_ = 0;
-        this->cache_length_ = 0;
-        return false;
-    }
-
-    // Read the data bytes from the file
-    const auto bytes_read = fread(this->file_buffer_, 1, HE_FILE_CACHE_SIZE, this->file_handle_);
-    if (bytes_read == 0)
-    {
-        this->cache_start_ = 0;
-        this->cache_length_ = 0;
-        return false;
-    }
-
-    // Store the current cache length
-    this->cache_length_ = bytes_read;
-
-    // Return sucess
-    return true;
-}
-
-/**
- * Reads the specified number of bytes from the cache into the specified buffer.
- * If the data at the desired reading position (file_cursor_) is not yet cached, 
- * the ReadIntoCache() function is called to cache the required data.
- * @param buffer The buffer to read into.
- * @param count The number of bytes to read.
- * @return The number of bytes that were read from the cache.
- */
-uint32_t TFile::ReadFromCache(unsigned char* buffer, uint32_t count) noexcept
-{
-    // Check, if the file cursor is in the cached range, if not refresh the cache
-    if ((this->file_cursor_ < this->cache_start_) || (this->file_cursor_ >= (this->cache_start_ + this->cache_length_)) ||
-       ((this->file_cursor_ + count) < this->cache_start_) || ((this->file_cursor_ + count) >= (this->cache_start_ + this->cache_length_)))
-    {
-        if ((HE_FILE_CACHE_SIZE / 2) > this->file_cursor_)
-            this->cache_start_ = 0;
-        else
-            this->cache_start_ = this->file_cursor_ - (HE_FILE_CACHE_SIZE / 2);
-        if (!this->ReadIntoCache()) return 0;
-    }
-    // Check if the whole area that is to read is in the cache, if not return less data
-    const int32_t bytes_to_read = hedit_min(static_cast<int32_t>(this->cache_length_ - (this->file_cursor_ - this->cache_start_)), static_cast<int32_t>(count));
-    if (bytes_to_read < 0) return 0;
-
-    // Everything ok, return the requested data
-    memset(buffer, 0, count);
-    memcpy(buffer, &this->file_buffer_[static_cast<int32_t>(this->file_cursor_ - this->cache_start_)], static_cast<std::size_t>(bytes_to_read));
-    return static_cast<uint32_t>(bytes_to_read);
-}
-
-/**
- * Assigns a new file name to the file class, closing the current file if open.
- * @param file_name The file name to assign to the file object.
- */
-void TFile::AssignFileName(const char* file_name)
-{
-    // Close any open file
-    this->Close();
-
-    // Assign the new file name
-    this->file_name_ = file_name;
-}
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers.hpp"
+
+/**
+ * Creates a new file instance initializing the buffer for the cache (if the
+ * file uses caching) and assigns a file name.
+ * @param file_name The name of the file to manage.
+ * @param use_cache true to use caching, false to do not.
+ * @param use_mapping true to read the file via a memory mapping (if the file can be mapped), false to do not.
+ * @param cache_size The size (in bytes) of the memory that is used for caching (rounded down to full cache pages).
+ */
+TFile::TFile(const char* file_name, bool use_cache, bool use_mapping, uint32_t cache_size)
+    : use_mapping_(use_mapping),
+    file_mapping_(nullptr),
+    mapping_length_(0),
+    file_cache_(nullptr),
+    cache_size_(cache_size),
+    cache_version_(0),
+    read_ahead_(nullptr),
+    direct_handle_(-1),
+    sector_size_(0),
+    dirty_data_(),
+    dirty_start_(0),
+    peek_buffer_(),
+    pinned_page_(-1),
+    hole_map_(),
+    overlay_(nullptr),
+    snapshot_(nullptr),
+    snapshot_name_(),
+    spool_(nullptr),
+    gzip_(nullptr),
+    progress_(nullptr),
+    progress_done_(0),
+    progress_total_(0),
+    hole_map_valid_(false),
+    file_cursor_(0),
+    file_size_(-1),
+    file_handle_(nullptr),
+    file_name_(nullptr),
+    file_attribute_(TFileAttribute::NORMAL),
+    unlocked_reads_(0)
+{
+    // If caching is to be used, create the read-ahead engine (the cache is assigned when the file is opened)
+    this->use_cache_ = use_cache;
+    if (this->use_cache_)
+    {
+        // Read ahead at most half of the cache, so that the pages of the scan are not recycled by the read-ahead
+        this->read_ahead_.reset(new TFileReadAhead(hedit_max(cache_size / HE_FILE_CACHE_PAGE_SIZE, 1U) / 2));
+    }
+
+    // No file is mapped yet (the mapping is created when the file is opened)
+    #if defined(_WIN32) || defined(__WIN32__)
+    this->mapping_handle_ = nullptr;
+    #endif
+
+    // Store file name for later use
+    this->file_name_ = file_name;
+}
+
+/**
+ * Destructor, closes the associated file (the cache is freed automatically).
+ */
+TFile::~TFile()
+{
+    // Close the file
+    this->Close();
+}
+
+/**
+ * Tries to open the file, setting the internal file attribute to
+ * TFileAttribute::ACCESS_DENIED if the file cannot be openend for any reason.
+ * @param mode The file mode to use for opening (see TFileMode).
+ * @return true on success, false otherwise.
+ */
+bool TFile::Open(TFileMode mode) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Close any open files
+    this->Close();
+
+    // Reset the file cursor
+    this->file_cursor_ = 0;
+    this->file_size_ = -1;
+    this->hole_map_valid_ = false;
+
+    // Gzip files are read decompressed, if requested (other files are read as they are)
+    if (mode == TFileMode::DECOMPRESS)
+    {
+        if (TFileGzip::IsCompressed(this->file_name_)) return this->OpenGzip();
+        mode = TFileMode::READ;
+    }
+
+    // Streams (the standard input and pipes) are read via a temporary file
+    if (TFileSpool::IsStream(this->file_name_)) return this->OpenSpool(mode);
+
+    // Attempt to open the file in the specified mode
+    if (mode == TFileMode::READ)
+    {
+        #if defined(WIN32) && !defined(__BORLANDC__)
+        this->file_handle_ = _fsopen(this->file_name_, "rb", _SH_DENYNO);
+        #else
+        this->file_handle_ = fopen(this->file_name_, "rb");
+        #endif
+        this->file_attribute_ = TFileAttribute::READ_ONLY;
+    }
+    else if (mode == TFileMode::READWRITE)
+    {
+        #if defined(WIN32) && !defined(__BORLANDC__)
+        this->file_handle_ = _fsopen(this->file_name_, "r+b", _SH_DENYNO);
+        #else
+        this->file_handle_ = fopen(this->file_name_, "r+b");
+        #endif
+        this->file_attribute_ = TFileAttribute::NORMAL;
+    }
+    else if (mode == TFileMode::CREATE)
+    {
+        #if defined(WIN32) && !defined(__BORLANDC__)
+        this->file_handle_ = _fsopen(this->file_name_, "w+b", _SH_DENYNO);
+        #else
+        this->file_handle_ = fopen(this->file_name_, "w+b");
+        #endif
+        this->file_attribute_ = TFileAttribute::NORMAL;
+    }
+
+    if (this->file_handle_ != nullptr)
+    {
+        // Valid file handle, set up the cache, the mapping and the direct I/O
+        this->AttachHandle(mode);
+
+        // Return success
+        return true;
+    }
+    else
+    {
+        // Invalid file handle, report as "File access denied"
+        this->file_attribute_ = TFileAttribute::ACCESS_DENIED;
+        return false;
+    }
+}
+
+/**
+ * Sets up the access to the opened file: the cache, the mapping, the direct I/O and the read-ahead. The caller must hold the lock.
+ * @param mode The file mode that was used for opening the file (see TFileMode).
+ */
+void TFile::AttachHandle(TFileMode mode) noexcept
+{
+    // Use the cache of the file (shared with the other file objects of the file)
+    if (this->use_cache_) this->AttachCache(mode);
+
+    // Try to map the file (pipes and devices silently fall back to stdio, streams grow while they are read,
+    // the decompressed content of gzip files is read via the decompressor)
+    if ((this->use_mapping_) && (!this->spool_) && (!this->gzip_)) this->MapFile();
+
+    // Block devices are read and written via direct I/O (the page cache provides the aligned buffers)
+    if ((this->use_cache_) && (!this->gzip_)) this->OpenDirect(mode);
+
+    // Sequential scans are read ahead via positional reads on the (direct I/O) handle
+    #if !(defined(_WIN32) || defined(__WIN32__))
+    if ((this->read_ahead_) && (!this->spool_) && (!this->gzip_))
+    {
+        const auto direct = (this->direct_handle_ >= 0);
+        this->read_ahead_->Attach((direct) ? this->direct_handle_ : fileno(this->file_handle_), !direct);
+    }
+    #endif
+}
+
+/**
+ * Opens a stream (the standard input or a pipe) for reading: the stream is copied into an anonymous temporary file
+ * in the background (see TFileSpool), which is read as the file. Reads wait until the data has arrived. The caller
+ * must hold the lock.
+ * @param mode The file mode to use for opening (streams can only be opened with TFileMode::READ).
+ * @return true on success, false otherwise.
+ */
+bool TFile::OpenSpool(TFileMode mode) noexcept
+{
+    // Streams can only be read
+    this->file_attribute_ = TFileAttribute::ACCESS_DENIED;
+    if (mode != TFileMode::READ) return false;
+
+    // Create the temporary file (it is deleted when it is closed) and start copying the stream
+    this->spool_.reset(new (std::nothrow) TFileSpool());
+    this->file_handle_ = tmpfile();
+    if ((!this->spool_) || (this->file_handle_ == nullptr) || (!this->spool_->Start(this->file_name_, fileno(this->file_handle_))))
+    {
+        this->spool_.reset();
+        if (this->file_handle_ != nullptr) fclose(this->file_handle_);
+        this->file_handle_ = nullptr;
+        return false;
+    }
+
+    // The temporary file is read via the cache, but it is not mapped while it grows
+    this->file_attribute_ = TFileAttribute::READ_ONLY;
+    this->AttachHandle(mode);
+    return true;
+}
+
+/**
+ * Opens the decompressed content of a gzip file for reading: the content is read via the checkpoints of the index
+ * (see TFileGzip), which is loaded from the cache or built in the background. Reads wait until the data is indexed.
+ * The caller must hold the lock.
+ * @return true on success, false otherwise.
+ */
+bool TFile::OpenGzip() noexcept
+{
+    // The decompressed content can only be read
+    this->file_attribute_ = TFileAttribute::ACCESS_DENIED;
+    this->file_handle_ = fopen(this->file_name_, "rb");
+    if (this->file_handle_ == nullptr) return false;
+
+    // Load or build the index
+    this->gzip_.reset(new (std::nothrow) TFileGzip(this->file_name_));
+    if ((!this->gzip_) || (!this->gzip_->Open(fileno(this->file_handle_))))
+    {
+        this->gzip_.reset();
+        fclose(this->file_handle_);
+        this->file_handle_ = nullptr;
+        return false;
+    }
+
+    // The decompressed content is read via the (private) cache
+    this->file_attribute_ = TFileAttribute::READ_ONLY;
+    this->AttachHandle(TFileMode::READ);
+    return true;
+}
+
+/**
+ * Closes the associated file, if open, an clears the internal cache.
+ */
+void TFile::Close() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Ensure a valid file handle
+    if (file_handle_ == nullptr) return;
+
+    // Write the pending data (if any, it is dropped if it cannot be written), the unsaved changes of the overlay are dropped
+    this->Flush();
+    this->dirty_data_.clear();
+    this->overlay_.reset();
+
+    // Stop taking the snapshot (an incomplete snapshot is deleted)
+    this->snapshot_.reset();
+    this->snapshot_name_.Free();
+
+    // Stop reading the stream (before its temporary file is closed) and stop indexing the gzip file
+    this->spool_.reset();
+    this->gzip_.reset();
+
+    // Forget the file size and the holes
+    this->file_size_ = -1;
+    this->hole_map_valid_ = false;
+
+    // Stop reading ahead and wait for the reads without the lock (before the handles are closed)
+    if (this->read_ahead_) this->read_ahead_->Detach();
+    this->WaitForUnlockedReads();
+
+    // Release the mapping and the direct I/O handle (if any)
+    this->UnmapFile();
+    this->CloseDirect();
+
+    // Close the file
+    fclose(file_handle_);
+
+    // Clear the file handle
+    this->file_handle_ = nullptr;
+
+    // Release the cache (and the pinned page)
+    this->DetachCache();
+}
+
+/**
+ * Reads the specified number of bytes from the current position in the file into the specified buffer.
+ * @param buffer The buffer to read the data into.
+ * @param length The size of the buffer (in bytes).
+ * @return The number of bytes read from the file.
+ */
+uint32_t TFile::Read(unsigned char* buffer, uint32_t length) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Clear the buffer
+    memset(buffer, 0, length);
+
+    // Check, if file opened
+    if (this->file_handle_ == nullptr) return 0;
+
+    // Check if to read from file cache or mapping
+    if (!this->UsesVirtualCursor())
+    {
+        // Cache disabled, read from file (a short read may indicate that the file was changed externally)
+        const auto bytes_read = fread(buffer, 1, length, this->file_handle_);
+        if (bytes_read < length) this->file_size_ = -1;
+        return bytes_read;
+    }
+
+    // Read at the virtual file cursor
+    const auto bytes_read = this->ReadData(buffer, length, this->file_cursor_);
+
+    // Advance position in file
+    this->file_cursor_ += bytes_read;
+
+    // Return number of bytes read from the file
+    return bytes_read;
+}
+
+/**
+ * Reads the specified number of bytes from the specified position in the file into the specified buffer.
+ * @param buffer The buffer to read the data into.
+ * @param length The size of the buffer (in bytes).
+ * @param position The zero-based position to read at.
+ * @return The number of bytes read from the file.
+ */
+uint32_t TFile::ReadAt(unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Try to set file pointer position
+    if (this->Seek(position) == false) return 0;
+
+    // Try to read there
+    return this->Read(buffer, length);
+}
+
+/**
+ * Returns a read-only view of the data at the specified position, without copying the data if possible.
+ * The view refers directly to a (pinned) cache page or to the data added to the overlay. Mapped data is copied into an
+ * internal buffer (the file may be truncated externally, see ReadFromMapping()), as is data that is not cached in a single
+ * page, that spans multiple pieces of the overlay or that has pending writes in the range.
+ * The view is valid until the next call of Peek(), Close() or of a function that changes the content (Write(), WriteAt(),
+ * PWrite(), Insert(), Erase(), Fill(), Save() or SaveAs()). Views are not thread-safe: they must only be used by the thread
+ * that called Peek(), other threads read via PRead() (which does not invalidate a view, even if the file is mapped again).
+ * @param position The zero-based position of the data.
+ * @param length The number of bytes requested.
+ * @param available Receives the number of valid bytes in the view (less than requested at the end of the file).
+ * @return The view of the data or nullptr if no data is available.
+ */
+const unsigned char* TFile::Peek(int64_t position, uint32_t length, uint32_t& available) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Nothing is available yet
+    available = 0;
+
+    // Check, if file opened
+    if ((this->file_handle_ == nullptr) || (position < 0) || (length == 0)) return nullptr;
+
+    // Release the page of the previous view
+    if ((this->file_cache_) && (this->pinned_page_ >= 0))
+    {
+        std::lock_guard<std::recursive_mutex> cache_lock(this->file_cache_->GetLock());
+        this->file_cache_->Unpin(this->pinned_page_);
+        this->pinned_page_ = -1;
+    }
+
+    // Translate the position into the file, if the overlay holds changes (only data within one piece can be referred to directly)
+    auto stored_position = position;
+    if (this->IsOverlayed())
+    {
+        TPiece piece = {};
+        int64_t piece_start = 0;
+        if (!this->overlay_->Find(position, piece, piece_start)) return nullptr;
+        const auto piece_offset = position - piece_start;
+        stored_position = ((piece.source == TPieceSource::FILE) && ((piece_offset + length) <= piece.length)) ? piece.offset + piece_offset : -1;
+        if ((piece.source == TPieceSource::ADDED) && ((piece_offset + length) <= piece.length))
+        {
+            available = length;
+            return this->overlay_->GetAddedData(piece.offset + piece_offset);
+        }
+    }
+
+    // Pending writes must be applied to a copy of the data
+    const auto dirty_end = this->dirty_start_ + static_cast<int64_t>(this->dirty_data_.size());
+    const auto is_dirty = ((!this->dirty_data_.empty()) && (stored_position < dirty_end) && ((stored_position + length) > this->dirty_start_));
+
+    // Refer to the cache page directly, if the data is within one page (or at the end of the file, unless a stream is still arriving)
+    if ((this->file_cache_) && (this->file_mapping_ == nullptr) && (!is_dirty) && (stored_position >= 0) && (!this->IsStreaming()))
+    {
+        std::lock_guard<std::recursive_mutex> cache_lock(this->file_cache_->GetLock());
+        this->CheckCacheVersion();
+        const auto page_start = stored_position - (stored_position % HE_FILE_CACHE_PAGE_SIZE);
+        const auto page = this->LoadCachePage(page_start);
+        if (page == nullptr) return nullptr;
+        const auto offset = static_cast<uint32_t>(stored_position - page_start);
+        if (offset >= page->length) return nullptr;
+        if (((offset + length) <= page->length) || (page->length < HE_FILE_CACHE_PAGE_SIZE))
+        {
+            // Pin the page, so that it is not recycled while the view is used
+            this->pinned_page_ = this->file_cache_->Pin(page_start);
+            available = hedit_min(length, page->length - offset);
+            return &page->data[offset];
+        }
+    }
+
+    // Read a copy of the data into the internal buffer
+    try
+    {
+        if (this->peek_buffer_.size() < length) this->peek_buffer_.resize(length);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+    available = this->ReadData(this->peek_buffer_.data(), length, position);
+    return (available > 0) ? this->peek_buffer_.data() : nullptr;
+}
+
+/**
+ * Writes the specified number of bytes from the specified buffer into the file at the current position.
+ * @param buffer The buffer with the data.
+ * @param length The number of bytes to write.
+ * @return The number of bytes written.
+ */
+uint32_t TFile::Write(const unsigned char* buffer, uint32_t length) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Check, if file opened
+    if (this->file_handle_ == nullptr) return 0;
+
+    // Check if the virtual file cursor is used
+    if (!this->UsesVirtualCursor())
+    {
+        // Write the data at the position of the stream and flush the stream
+        const auto bytes_written = fwrite(buffer, 1, length, this->file_handle_);
+        fflush(this->file_handle_);
+
+        // The position of the stdio stream is not tracked, query the size (and the holes) again
+        this->file_size_ = -1;
+        this->hole_map_valid_ = false;
+        return bytes_written;
+    }
+
+    // Write at the virtual file cursor
+    const auto bytes_written = this->WriteData(buffer, length, this->file_cursor_);
+
+    // Advance position in file
+    this->file_cursor_ += bytes_written;
+
+    // Return the number of bytes written
+    return bytes_written;
+}
+
+/**
+ * Reads the specified number of bytes from the specified position in the file into the specified buffer,
+ * without using or changing the file cursor. The function is thread-safe, so a file can be read by
+ * multiple threads concurrently (e.g. by background workers while the viewers draw). Large blocks that
+ * are neither cached nor changed are read from the file without holding the lock (see CanReadUnlocked()),
+ * so that the reads of multiple threads are not serialized. A read never invalidates the view of another thread (see Peek()).
+ * @param buffer The buffer to read the data into.
+ * @param length The size of the buffer (in bytes).
+ * @param position The zero-based position to read at.
+ * @return The number of bytes read from the file.
+ */
+uint32_t TFile::PRead(unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    std::unique_lock<std::recursive_mutex> lock(this->mutex_);
+
+    // Check, if file opened
+    if ((this->file_handle_ == nullptr) || (position < 0)) return 0;
+
+    // Read the data under the lock, unless it can be read from the file directly
+    if (!this->CanReadUnlocked(length, position)) return this->ReadData(buffer, length, position);
+
+    // Register the read, so that the handle is not closed before the read is completed (see Close())
+    {
+        std::lock_guard<std::mutex> read_lock(this->unlocked_read_mutex_);
+        this->unlocked_reads_++;
+    }
+
+    // Read until all data is read or the end of the file is reached
+    uint32_t bytes_read = 0;
+    #if !(defined(_WIN32) || defined(__WIN32__))
+    const auto handle = fileno(this->file_handle_);
+    lock.unlock();
+    while (bytes_read < length)
+    {
+        const auto result = pread(handle, &buffer[bytes_read], length - bytes_read, position + bytes_read);
+        if ((result < 0) && (errno == EINTR)) continue;
+        if (result <= 0) break;
+        bytes_read += static_cast<uint32_t>(result);
+    }
+    #endif
+
+    // The read is completed
+    {
+        std::lock_guard<std::mutex> read_lock(this->unlocked_read_mutex_);
+        this->unlocked_reads_--;
+    }
+    this->unlocked_read_signal_.notify_all();
+    return bytes_read;
+}
+
+/**
+ * Checks if the specified data can be read from the file without holding the lock (see PRead()): the content must
+ * not be changed by the overlay or by pending writes, must not be read via a stream, a decompressor or direct I/O,
+ * and (if caching is used) must span at least one cache page and must not be completely cached already. The reads are positional reads on the handle, which are independent
+ * of the file object (the stdio stream of Windows is not). The caller must hold the lock.
+ * @param length The number of bytes to read.
+ * @param position The zero-based position to read at.
+ * @return true if the data can be read without the lock, false otherwise.
+ */
+bool TFile::CanReadUnlocked(uint32_t length, int64_t position) noexcept
+{
+    #if defined(_WIN32) || defined(__WIN32__)
+        return false;
+    #else
+        // The content must be read via the file object
+        if ((this->IsOverlayed()) || (this->spool_) || (this->gzip_) || (this->direct_handle_ >= 0)) return false;
+
+        // Pending writes must be applied to the data
+        const auto end = position + length;
+        const auto dirty_end = this->dirty_start_ + static_cast<int64_t>(this->dirty_data_.size());
+        if ((!this->dirty_data_.empty()) && (position < dirty_end) && (end > this->dirty_start_)) return false;
+
+        // Small reads use the cache (and its read-ahead), large reads that are not completely cached bypass it (they would displace the pages of the views)
+        if (!this->file_cache_) return true;
+        if (length < HE_FILE_CACHE_PAGE_SIZE) return false;
+        std::lock_guard<std::recursive_mutex> cache_lock(this->file_cache_->GetLock());
+        for (auto page_start = position - (position % HE_FILE_CACHE_PAGE_SIZE); page_start < end; page_start += HE_FILE_CACHE_PAGE_SIZE)
+        {
+            if (!this->file_cache_->Contains(page_start)) return true;
+        }
+        return false;
+    #endif
+}
+
+/**
+ * Waits until all reads that run without the lock are completed (see PRead()), so that the handle can be closed.
+ * The caller must hold the lock (no new reads are started then).
+ */
+void TFile::WaitForUnlockedReads() noexcept
+{
+    std::unique_lock<std::mutex> read_lock(this->unlocked_read_mutex_);
+    this->unlocked_read_signal_.wait(read_lock, [this] { return (this->unlocked_reads_ == 0); });
+}
+
+/**
+ * Writes the specified number of bytes from the specified buffer into the file at the the specified position,
+ * without using or changing the file cursor. The function is thread-safe, but it invalidates the views (see Peek()).
+ * @param buffer The buffer with the data.
+ * @param length The number of bytes to write.
+ * @param position The zero-based position to write at.
+ * @return The number of bytes written.
+ */
+uint32_t TFile::PWrite(const unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Check, if file opened
+    if ((this->file_handle_ == nullptr) || (position < 0)) return 0;
+
+    // Write the data
+    return this->WriteData(buffer, length, position);
+}
+
+/**
+ * Copies the specified range of the (changed) content into the target file at the specified position. Ranges that
+ * are stored in the file are copied within the kernel if possible (see CopyStoredData()), all other data is copied
+ * via a buffer in large blocks. The data is written directly into the target file, which must not hold unsaved changes.
+ * @param target The target file (opened for writing).
+ * @param position The zero-based position of the data.
+ * @param length The number of bytes to copy.
+ * @param target_position The zero-based position in the target file.
+ * @return The number of bytes copied (less than requested if the end of the file is reached or on errors).
+ */
+int64_t TFile::CopyTo(TFile* target, int64_t position, int64_t length, int64_t target_position) noexcept
+{
+    // Lock both files (std::lock avoids deadlocks, regardless of the order)
+    std::unique_lock<std::recursive_mutex> lock(this->mutex_, std::defer_lock);
+    std::unique_lock<std::recursive_mutex> target_lock(target->mutex_, std::defer_lock);
+    std::lock(lock, target_lock);
+
+    // Check the files and the range
+    if ((this->file_handle_ == nullptr) || (target->file_handle_ == nullptr) || (target->IsReadOnly())) return 0;
+    if ((position < 0) || (length <= 0) || (target_position < 0)) return 0;
+    if ((target->IsOverlayed()) || (!target->Flush()) || (!target->CompleteSnapshot(nullptr))) return 0;
+
+    // Copy piece by piece (without changes, the whole range is stored in the file)
+    int64_t bytes_copied = 0;
+    while (bytes_copied < length)
+    {
+        // Find the file range of the next data (changed data has no file range)
+        auto count = length - bytes_copied;
+        auto stored_position = position + bytes_copied;
+        if (this->IsOverlayed())
+        {
+            TPiece piece = {};
+            int64_t piece_start = 0;
+            if (!this->overlay_->Find(position + bytes_copied, piece, piece_start)) break;
+            const auto piece_offset = position + bytes_copied - piece_start;
+            count = hedit_min(count, piece.length - piece_offset);
+            stored_position = (piece.source == TPieceSource::FILE) ? piece.offset + piece_offset : -1;
+        }
+
+        // Copy within the kernel if possible, the rest via a buffer
+        auto result = (stored_position >= 0) ? this->CopyStoredData(target, stored_position, count, target_position + bytes_copied) : 0;
+        if (result < count) result += this->CopyBuffered(target, position + bytes_copied + result, count - result, target_position + bytes_copied + result);
+        bytes_copied += result;
+        if (result < count) break;
+    }
+
+    // Return the number of bytes copied
+    return bytes_copied;
+}
+
+/**
+ * Reads the specified number of bytes at the specified position, either via the overlay (if it holds changes)
+ * or directly from the file. The caller must hold the lock.
+ * @param buffer The buffer to read the data into.
+ * @param length The number of bytes to read.
+ * @param position The zero-based position to read at.
+ * @return The number of bytes read.
+ */
+uint32_t TFile::ReadData(unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    return (this->IsOverlayed()) ? this->ReadFromOverlay(buffer, length, position) : this->ReadStoredData(buffer, length, position);
+}
+
+/**
+ * Writes the specified number of bytes at the specified position, either into the overlay (if enabled)
+ * or into the file. The caller must hold the lock.
+ * @param buffer The buffer with the data.
+ * @param length The number of bytes to write.
+ * @param position The zero-based position to write at.
+ * @return The number of bytes written.
+ */
+uint32_t TFile::WriteData(const unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    // Without overlay, the data is written to the file (after the snapshot is taken)
+    if (!this->overlay_) return (this->CompleteSnapshot(nullptr)) ? this->WriteStoredData(buffer, length, position) : 0;
+
+    // Collect the change in the overlay
+    if ((!this->PrepareOverlay()) || (!this->overlay_->Replace(position, buffer, length))) return 0;
+    return length;
+}
+
+/**
+ * Returns true if the overlay is enabled and holds changes, so that the content is to be read via the overlay.
+ * @return true if the overlay holds changes, false otherwise.
+ */
+bool TFile::IsOverlayed() const noexcept
+{
+    return ((this->overlay_) && (this->overlay_->IsModified()));
+}
+
+/**
+ * Prepares the overlay for a change. An overlay without changes is (re)started with the current file content,
+ * so that the changes of other file objects that were saved in the meantime are taken into account.
+ * @return true on success, false otherwise.
+ */
+bool TFile::PrepareOverlay() noexcept
+{
+    if (this->overlay_->IsModified()) return true;
+
+    // The first change starts taking the snapshot, which is needed before the changes are saved
+    this->StartSnapshot();
+    return this->overlay_->Reset(this->GetStoredSize());
+}
+
+/**
+ * Reads the specified number of bytes at the specified position via the overlay, piece by piece.
+ * The caller must hold the lock.
+ * @param buffer The buffer to read the data into.
+ * @param length The number of bytes to read.
+ * @param position The zero-based position to read at.
+ * @return The number of bytes read.
+ */
+uint32_t TFile::ReadFromOverlay(unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    uint32_t bytes_read = 0;
+    TPiece piece = {};
+    int64_t piece_start = 0;
+
+    // Copy the data of each piece until all data is read or the end of the content is reached
+    while ((bytes_read < length) && (this->overlay_->Find(position + bytes_read, piece, piece_start)))
+    {
+        const auto piece_offset = position + bytes_read - piece_start;
+        const auto count = static_cast<uint32_t>(hedit_min(static_cast<int64_t>(length - bytes_read), piece.length - piece_offset));
+        if (piece.source == TPieceSource::FILE)
+        {
+            // A short read indicates that the file was truncated externally
+            const auto bytes_stored = this->ReadStoredData(&buffer[bytes_read], count, piece.offset + piece_offset);
+            if (bytes_stored < count) return bytes_read + bytes_stored;
+        }
+        else if (piece.source == TPieceSource::ADDED)
+        {
+            memcpy(&buffer[bytes_read], this->overlay_->GetAddedData(piece.offset + piece_offset), count);
+        }
+        else
+        {
+            memset(&buffer[bytes_read], 0, count);
+        }
+        bytes_read += count;
+    }
+
+    // Return number of bytes read
+    return bytes_read;
+}
+
+/**
+ * Reads the specified number of bytes at the specified position from the mapping, the cache or the file
+ * (in this order) and applies the pending writes. The caller must hold the lock.
+ * @param buffer The buffer to read the data into.
+ * @param length The number of bytes to read.
+ * @param position The zero-based file position to read at.
+ * @return The number of bytes read.
+ */
+uint32_t TFile::ReadStoredData(unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    uint32_t bytes_read = 0;
+
+    // Wait for the data of a stream, an incomplete page is read without the cache (it would not be reloaded)
+    auto use_cache = static_cast<bool>(this->file_cache_);
+    if (this->spool_)
+    {
+        const auto available = this->spool_->WaitFor(position + length);
+        const auto page_end = ((position + length + HE_FILE_CACHE_PAGE_SIZE - 1) / HE_FILE_CACHE_PAGE_SIZE) * HE_FILE_CACHE_PAGE_SIZE;
+        if ((available < page_end) && (!this->spool_->IsDone())) use_cache = false;
+    }
+
+    // Wait for the index of a gzip file the same way
+    if (this->gzip_)
+    {
+        const auto available = this->gzip_->WaitFor(position + length);
+        const auto page_end = ((position + length + HE_FILE_CACHE_PAGE_SIZE - 1) / HE_FILE_CACHE_PAGE_SIZE) * HE_FILE_CACHE_PAGE_SIZE;
+        if ((available < page_end) && (!this->gzip_->IsDone())) use_cache = false;
+    }
+
+    // Read from the mapping, the cache or the file (a short read may indicate that the file was changed externally)
+    if (this->CheckMapping())
+    {
+        bytes_read = this->ReadFromMapping(buffer, length, position);
+    }
+    else
+    {
+        bytes_read = (use_cache) ? this->ReadFromCache(buffer, length, position) : this->ReadFromHandle(buffer, length, position);
+        if (bytes_read < length) this->file_size_ = -1;
+    }
+
+    // Apply the pending writes
+    this->ReadFromBuffer(buffer, bytes_read, position);
+
+    // Return number of bytes read
+    return bytes_read;
+}
+
+/**
+ * Writes the specified number of bytes at the specified position, either into the write-back buffer or
+ * directly into the file, and updates the cache, the file size and the mapping. The caller must hold the lock.
+ * @param buffer The buffer with the data.
+ * @param length The number of bytes to write.
+ * @param position The zero-based file position to write at.
+ * @return The number of bytes written.
+ */
+uint32_t TFile::WriteStoredData(const unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    // Try to collect the data in the write-back buffer
+    if (this->WriteToBuffer(buffer, length, position)) return length;
+
+    // Write the pending data first, to keep the order of the writes
+    if (!this->Flush()) return 0;
+
+    // Writes go always directly to the file (block devices write whole sectors via direct I/O)
+    const auto bytes_written = (this->direct_handle_ >= 0) ? this->WriteDirect(buffer, length, position) : this->WriteToHandle(buffer, length, position);
+
+    // Ensure the bytes were written (a failed write leaves the file size unknown)
+    if (bytes_written < length) this->file_size_ = -1;
+    if (bytes_written == 0) return 0;
+
+    // Patch the written data into the cached pages (if caching is used)
+    if (this->file_cache_) this->UpdateCache(position, buffer, bytes_written);
+
+    // Update the file size, if the file was extended
+    if (this->file_size_ >= 0) this->file_size_ = hedit_max(this->file_size_, position + bytes_written);
+
+    // Extend the mapping, if the file has grown beyond the mapped range
+    if ((this->file_mapping_ != nullptr) && ((position + bytes_written) > this->mapping_length_))
+    {
+        this->UnmapFile();
+        this->MapFile();
+    }
+
+    // Return the number of bytes written
+    return bytes_written;
+}
+
+/**
+ * Reads the specified number of bytes at the specified position directly from the file handle, without
+ * changing the position of the stdio stream. The caller must hold the lock.
+ * @param buffer The buffer to read the data into.
+ * @param length The number of bytes to read.
+ * @param position The zero-based position to read at.
+ * @return The number of bytes read.
+ */
+uint32_t TFile::ReadFromHandle(unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    // The content of a gzip file is decompressed
+    if (this->gzip_) return this->gzip_->Read(buffer, length, position);
+
+    #if defined(_WIN32) || defined(__WIN32__)
+        // Read via the stream, restoring its position afterwards
+        const auto old_pos = _ftelli64(this->file_handle_);
+        if (_fseeki64(this->file_handle_, position, SEEK_SET) != 0) return 0;
+        const auto bytes_read = static_cast<uint32_t>(fread(buffer, 1, length, this->file_handle_));
+        _fseeki64(this->file_handle_, old_pos, SEEK_SET);
+        return bytes_read;
+    #else
+        // Read until all data is read or the end of the file is reached
+        uint32_t bytes_read = 0;
+        while (bytes_read < length)
+        {
+            const auto result = pread(fileno(this->file_handle_), &buffer[bytes_read], length - bytes_read, position + bytes_read);
+            if ((result < 0) && (errno == EINTR)) continue;
+            if (result <= 0) break;
+            bytes_read += static_cast<uint32_t>(result);
+        }
+        return bytes_read;
+    #endif
+}
+
+/**
+ * Writes the specified number of bytes at the specified position directly to the file handle, without
+ * changing the position of the stdio stream. The caller must hold the lock.
+ * @param buffer The buffer with the data.
+ * @param length The number of bytes to write.
+ * @param position The zero-based position to write at.
+ * @return The number of bytes written.
+ */
+uint32_t TFile::WriteToHandle(const unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    // Pages that are read ahead may become outdated, holes may be filled
+    if (this->read_ahead_) this->read_ahead_->Cancel();
+    this->hole_map_valid_ = false;
+
+    #if defined(_WIN32) || defined(__WIN32__)
+        // Write via the stream, restoring its position afterwards
+        const auto old_pos = _ftelli64(this->file_handle_);
+        if (_fseeki64(this->file_handle_, position, SEEK_SET) != 0) return 0;
+        const auto bytes_written = static_cast<uint32_t>(fwrite(buffer, 1, length, this->file_handle_));
+        fflush(this->file_handle_);
+        _fseeki64(this->file_handle_, old_pos, SEEK_SET);
+        return bytes_written;
+    #else
+        // Write until all data is written or an error occurs
+        uint32_t bytes_written = 0;
+        while (bytes_written < length)
+        {
+            const auto result = pwrite(fileno(this->file_handle_), &buffer[bytes_written], length - bytes_written, position + bytes_written);
+            if ((result < 0) && (errno == EINTR)) continue;
+            if (result <= 0) break;
+            bytes_written += static_cast<uint32_t>(result);
+        }
+
+        // Drop the read buffer of the stream, it may hold outdated data now
+        if (!this->UsesVirtualCursor()) _fseeki64(this->file_handle_, _ftelli64(this->file_handle_), SEEK_SET);
+        return bytes_written;
+    #endif
+}
+
+/**
+ * Writes the specified number of bytes from the specified buffer into the file at the the specified position.
+ * @param buffer The buffer with the data.
+ * @param length The number of bytes to write.
+ * @param position The zero-based position to write at.
+ * @return The number of bytes written.
+ */
+uint32_t TFile::WriteAt(const unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Try to set file pointer position
+    if (this->Seek(position) == false) return 0;
+
+    // Try to write there
+    return this->Write(buffer, length);
+}
+
+/**
+ * Positions the file cursor.
+ * @param position The new absolute position of the file pointer (zero-based).
+ * @return true on success, false otherwise.
+ */
+bool TFile::Seek(int64_t position) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Check, if file opened
+    if (this->file_handle_ == nullptr) return false;
+
+    // Ensure a valid (positive) position
+    if (position < 0) return false;
+
+    // Check if caching or mapping is used
+    if (this->UsesVirtualCursor())
+    {
+        // Set the position of the virtual file pointer
+        this->file_cursor_ = position;
+
+        // Always return success
+        return true;
+    }
+    else
+    {
+        // Set the position of the real file pointer
+        if (_fseeki64(this->file_handle_, position, SEEK_SET) < 0) return false;
+
+        // Return success
+        return true;
+    }
+}
+
+/**
+ * Writes the pending data of the write-back buffer to the file. If the data cannot be written, it is kept pending
+ * (it is still read back, and written by the next call).
+ * @return true on success (or if no data is pending), false otherwise.
+ */
+bool TFile::Flush() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Check if there is pending data
+    if (this->dirty_data_.empty()) return true;
+
+    // Write the pending data at once
+    const auto length = static_cast<uint32_t>(this->dirty_data_.size());
+    auto success = (this->file_handle_ != nullptr);
+    if ((success) && (this->direct_handle_ >= 0))
+    {
+        success = (this->WriteDirect(this->dirty_data_.data(), length, this->dirty_start_) == length);
+    }
+    else if (success)
+    {
+        success = (this->WriteToHandle(this->dirty_data_.data(), length, this->dirty_start_) == length);
+    }
+
+    // Update the cached pages (they may have been loaded while the data was pending)
+    if ((this->file_cache_) && (success))
+    {
+        this->UpdateCache(this->dirty_start_, this->dirty_data_.data(), length);
+    }
+    else if (this->file_cache_)
+    {
+        std::lock_guard<std::recursive_mutex> cache_lock(this->file_cache_->GetLock());
+        this->file_cache_->Invalidate();
+    }
+
+    // The data is no longer pending (unless it could not be written, it is written again by the next call then)
+    if (success) this->dirty_data_.clear();
+
+    // Return the result
+    return success;
+}
+
+/**
+ * Returns true if the write-back buffer holds data that is not yet written to the file, false otherwise.
+ * @return true if there is pending data, false otherwise.
+ */
+bool TFile::IsDirty() const noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    return (!this->dirty_data_.empty());
+}
+
+/**
+ * Enables the overlay, so that all following changes (writes, inserts and erases) are collected in memory and
+ * the file is not changed until Save() is called. The reads return the changed content. Unsaved changes are
+ * dropped when the file is closed. The overlay can only be enabled for files that are opened for writing.
+ * @return true on success (or if the overlay is already enabled), false otherwise.
+ */
+bool TFile::EnableOverlay() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Check if the overlay can be used
+    if ((this->file_handle_ == nullptr) || (this->IsReadOnly())) return false;
+    if (this->overlay_) return true;
+
+    // Write the pending data, all following changes are collected by the overlay
+    if (!this->Flush()) return false;
+
+    // Take over the position of the stdio stream, the overlay uses the virtual file cursor
+    const auto position = (this->UsesVirtualCursor()) ? this->file_cursor_ : _ftelli64(this->file_handle_);
+
+    // Create the overlay (the pieces are created with the first change)
+    try
+    {
+        this->overlay_.reset(new TPieceTable());
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+    this->file_cursor_ = hedit_max(position, static_cast<int64_t>(0));
+    return true;
+}
+
+/**
+ * Disables the overlay, so that the following changes are written via the write-back buffer again (see EnableOverlay()).
+ * The overlay can only be disabled, if it holds no unsaved changes.
+ * @return true on success (or if the overlay is not enabled), false if there are unsaved changes.
+ */
+bool TFile::DisableOverlay() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Check if the overlay can be dropped
+    if (!this->overlay_) return true;
+    if (this->overlay_->IsModified()) return false;
+
+    // Drop the overlay, the stdio stream takes over the position of the virtual file cursor (if it is no longer used)
+    this->overlay_.reset();
+    if ((this->file_handle_ != nullptr) && (!this->UsesVirtualCursor())) _fseeki64(this->file_handle_, this->file_cursor_, SEEK_SET);
+    return true;
+}
+
+/**
+ * Enables taking a snapshot (backup copy) of the file before it is changed for the first time (see TFileSnapshot).
+ * With the overlay, the snapshot is started in the background with the first change and completed before the changes
+ * are saved, otherwise it is taken before the first write. Only regular files can be snapshotted.
+ * @param snapshot_name The name of the snapshot (an existing file is overwritten).
+ * @return true on success, false otherwise.
+ */
+bool TFile::EnableSnapshot(const char* snapshot_name) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Check if a snapshot can be taken
+    if ((this->file_handle_ == nullptr) || (this->IsReadOnly()) || (this->direct_handle_ >= 0)) return false;
+    #if !(defined(_WIN32) || defined(__WIN32__))
+        struct stat file_info = {};
+        if ((fstat(fileno(this->file_handle_), &file_info) != 0) || (!S_ISREG(file_info.st_mode))) return false;
+    #endif
+
+    // Remember the name, the snapshot is taken with the first change
+    try
+    {
+        this->snapshot_name_ = snapshot_name;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Returns true if the snapshot is being copied in the background, false otherwise.
+ * @return true if the snapshot is pending, false otherwise.
+ */
+bool TFile::IsSnapshotPending() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+    return ((this->snapshot_) && (!this->snapshot_->IsDone()));
+}
+
+/**
+ * Inserts the specified data at the specified position, shifting the following data. The change is collected
+ * in the overlay (which is enabled, if required) and written to the file by Save().
+ * @param position The zero-based position to insert at (up to the file size).
+ * @param buffer The data to insert or nullptr to insert zeros.
+ * @param length The number of bytes to insert.
+ * @return true on success, false otherwise.
+ */
+bool TFile::Insert(int64_t position, const unsigned char* buffer, int64_t length) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Collect the change in the overlay
+    if ((!this->EnableOverlay()) || (!this->PrepareOverlay())) return false;
+    return this->overlay_->Insert(position, buffer, length);
+}
+
+/**
+ * Erases the specified range, shifting the following data. The change is collected in the overlay
+ * (which is enabled, if required) and written to the file by Save().
+ * @param position The zero-based position of the first byte to erase.
+ * @param length The number of bytes to erase (limited to the end of the file).
+ * @return true on success, false otherwise.
+ */
+bool TFile::Erase(int64_t position, int64_t length) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Collect the change in the overlay
+    if ((!this->EnableOverlay()) || (!this->PrepareOverlay())) return false;
+    return this->overlay_->Erase(position, length);
+}
+
+/**
+ * Fills the specified range with repeated copies of the specified pattern. The pattern is replicated into a block
+ * of up to HE_FILE_SAVE_BLOCK_SIZE bytes, which is written as a whole. If the overlay is enabled, the block is
+ * stored only once (see TPieceTable::Fill()) and the range is written by Save(). Zeros are not written at all
+ * if possible, but punched out of the file (see PunchStoredRange()).
+ * @param position The zero-based position of the range.
+ * @param pattern The pattern to fill the range with.
+ * @param pattern_length The length of the pattern (the last copy of the pattern is truncated).
+ * @param length The length of the range.
+ * @param progress The receiver of the progress (nullptr if not required), called after each block.
+ * @return true on success, false otherwise (the range may be partially filled then).
+ */
+bool TFile::Fill(int64_t position, const unsigned char* pattern, uint32_t pattern_length, int64_t length, TFileProgress* progress) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Ensure a valid range and pattern
+    if ((this->file_handle_ == nullptr) || (this->IsReadOnly()) || (position < 0) || (length < 0) || (pattern_length == 0) || (pattern_length > HE_FILE_SAVE_BLOCK_SIZE)) return false;
+    const auto zeros = (std::count(pattern, &pattern[pattern_length], 0) == static_cast<std::ptrdiff_t>(pattern_length));
+
+    // Replicate the pattern into a block that holds a multiple of the pattern
+    std::vector<unsigned char> block;
+    try
+    {
+        block.resize(static_cast<std::size_t>(hedit_min(length, static_cast<int64_t>((HE_FILE_SAVE_BLOCK_SIZE / pattern_length) * pattern_length))));
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+    ReplicatePattern(block.data(), block.size(), pattern, pattern_length);
+
+    // Collect the change in the overlay
+    if (this->overlay_)
+    {
+        const auto success = ((this->PrepareOverlay()) && (this->overlay_->Fill(position, zeros ? nullptr : block.data(), static_cast<int64_t>(block.size()), length)));
+        if ((success) && (progress != nullptr)) progress->Progress(length, length);
+        return success;
+    }
+
+    // Write the range block by block, zeros are punched out of the file, if possible
+    if (!this->CompleteSnapshot(progress)) return false;
+    this->progress_ = progress;
+    this->progress_done_ = 0;
+    this->progress_total_ = length;
+    this->ReportProgress(0);
+    const auto success = (zeros) ? this->ClearStoredRange(position, length, block) : this->WriteStoredRange(block.data(), static_cast<int64_t>(block.size()), length, position);
+    this->progress_ = nullptr;
+    return success;
+}
+
+/**
+ * Writes the changes that are collected by the overlay to the file (and the pending data of the write-back buffer).
+ * The file is changed in place: if supported, block-aligned inserts and erasures are made by inserting and collapsing
+ * ranges of the file (see ShiftStoredData()). Then the pieces of the file that moved towards the start are copied (in ascending
+ * order) and the pieces that moved towards the end (in descending order, each from its end backwards), so that no
+ * data is overwritten before it is copied. Afterwards the added data is written and the file is truncated, if it shrank.
+ * If data was only overwritten, no data is moved at all and only the changed ranges are written.
+ * @param progress The receiver of the progress (nullptr if not required), called after each block.
+ * @return true on success, false otherwise (the file may be partially changed then).
+ */
+bool TFile::Save(TFileProgress* progress) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Without changes in the overlay, only the pending data is written
+    if (!this->IsOverlayed()) return this->Flush();
+    if (this->file_handle_ == nullptr) return false;
+
+    // The size of a device cannot be changed
+    const auto new_size = this->overlay_->Size();
+    if ((this->direct_handle_ >= 0) && (new_size != this->GetStoredSize())) return false;
+
+    // The snapshot must be complete before the file is changed
+    if (!this->CompleteSnapshot(progress)) return false;
+
+    // Get the pieces and the buffer for copying
+    std::vector<TPiece> pieces;
+    std::vector<unsigned char> block;
+    try
+    {
+        pieces = this->overlay_->GetPieces();
+        block.resize(HE_FILE_SAVE_BLOCK_SIZE);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+
+    // Insert and collapse the block-aligned ranges of the file, so that the following data need not be copied
+    this->ShiftStoredData(pieces);
+    const auto old_size = this->GetStoredSize();
+
+    // Calculate the number of bytes to move and to write
+    int64_t position = 0;
+    this->progress_ = progress;
+    this->progress_done_ = 0;
+    this->progress_total_ = 0;
+    for (const auto& piece : pieces)
+    {
+        if ((piece.source != TPieceSource::FILE) || (piece.offset != position)) this->progress_total_ += piece.length;
+        position += piece.length;
+    }
+    this->ReportProgress(0);
+
+    // Move the pieces of the file that moved towards the start (in ascending order)
+    auto success = true;
+    position = 0;
+    for (const auto& piece : pieces)
+    {
+        if ((success) && (piece.source == TPieceSource::FILE) && (position < piece.offset)) success = this->MoveStoredData(piece.offset, position, piece.length, block);
+        position += piece.length;
+    }
+
+    // Move the pieces of the file that moved towards the end (in descending order)
+    for (auto piece = pieces.rbegin(); piece != pieces.rend(); ++piece)
+    {
+        position -= piece->length;
+        if ((success) && (piece->source == TPieceSource::FILE) && (position > piece->offset)) success = this->MoveStoredData(piece->offset, position, piece->length, block);
+    }
+
+    // Extend the file, so that the zeros can be punched out of the file
+    if ((success) && (new_size > this->GetStoredSize())) success = this->TruncateStoredData(new_size);
+
+    // Write the added data and the zeros
+    memset(block.data(), 0, block.size());
+    for (const auto& piece : pieces)
+    {
+        if ((success) && (piece.source == TPieceSource::ADDED)) success = this->WriteStoredRange(this->overlay_->GetAddedData(piece.offset), piece.length, piece.length, position);
+        if ((success) && (piece.source == TPieceSource::ZERO)) success = this->ClearStoredRange(position, piece.length, block);
+        position += piece.length;
+    }
+
+    // Cut off the rest of the file, if the file shrank
+    if ((success) && (new_size < old_size)) success = this->TruncateStoredData(new_size);
+
+    // Write the pending data
+    success = ((this->Flush()) && (success));
+
+    // Start over with the saved content
+    if (success) this->overlay_->Reset(0);
+    this->progress_ = nullptr;
+    return success;
+}
+
+/**
+ * Writes the current content (including the unsaved changes) to a new file and switches to the new file, which is
+ * opened for reading and writing then. The unchanged ranges of the file are copied within the kernel, if possible
+ * (see CopyStoredData()), the changed ranges are written in large blocks and the zeros are left as holes. The new
+ * file is synced once at the end. The file object keeps its settings and its position, the overlay (if enabled)
+ * starts over with the saved content and the snapshot (if enabled) is not taken for the new file.
+ * @param file_name The name of the new file (an existing file is overwritten, but it must not be the file itself).
+ * @param progress The receiver of the progress (nullptr if not required), called after each block.
+ * @return true on success, false otherwise (the new file is deleted then and the file object is unchanged).
+ */
+bool TFile::SaveAs(const char* file_name, TFileProgress* progress) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Write the pending data, the content is read from the file
+    if ((this->file_handle_ == nullptr) || (!this->Flush())) return false;
+
+    // The file cannot be saved onto itself (it would be truncated before it is read)
+    #if !(defined(_WIN32) || defined(__WIN32__))
+        struct stat file_info = {};
+        struct stat target_info = {};
+        if ((fstat(fileno(this->file_handle_), &file_info) == 0) && (stat(file_name, &target_info) == 0) &&
+            (file_info.st_dev == target_info.st_dev) && (file_info.st_ino == target_info.st_ino)) return false;
+    #endif
+
+    // The file cannot be saved onto a file that is open in another file object (it would be truncated under its cache and its mapping)
+    if (TFile::IsFileShared(file_name)) return false;
+
+    // Get the pieces of the content (without changes, the whole file is one piece) and the buffer for copying
+    const auto size = this->FileSize();
+    std::vector<TPiece> pieces;
+    std::vector<unsigned char> block;
+    TString new_file_name;
+    try
+    {
+        if (this->IsOverlayed())
+            pieces = this->overlay_->GetPieces();
+        else if (size > 0)
+            pieces.push_back({ TPieceSource::FILE, 0, size });
+        block.resize(HE_FILE_SAVE_BLOCK_SIZE);
+        new_file_name = file_name;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+
+    // Create the new file (it is neither cached nor mapped while it is written)
+    std::unique_ptr<TFile> target(new (std::nothrow) TFile(file_name, false));
+    if ((!target) || (!target->Open(TFileMode::CREATE))) return false;
+
+    // Write the pieces block by block
+    auto success = true;
+    int64_t position = 0;
+    this->progress_ = progress;
+    this->progress_done_ = 0;
+    this->progress_total_ = size;
+    this->ReportProgress(0);
+    for (const auto& piece : pieces)
+    {
+        int64_t bytes_written = 0;
+        while ((success) && (bytes_written < piece.length))
+        {
+            const auto count = static_cast<uint32_t>(hedit_min(piece.length - bytes_written, static_cast<int64_t>(HE_FILE_SAVE_BLOCK_SIZE)));
+            const auto target_position = position + bytes_written;
+            if (piece.source == TPieceSource::ADDED)
+            {
+                // Write the changed data
+                success = (target->WriteStoredData(this->overlay_->GetAddedData(piece.offset + bytes_written), count, target_position) == count);
+            }
+            else if (piece.source == TPieceSource::FILE)
+            {
+                // Copy the unchanged data within the kernel if possible, the rest via the buffer
+                const auto copied = static_cast<uint32_t>(this->CopyStoredData(target.get(), piece.offset + bytes_written, count, target_position));
+                const auto rest = count - copied;
+                if (rest > 0)
+                {
+                    success = ((this->ReadStoredData(block.data(), rest, piece.offset + bytes_written + copied) == rest) &&
+                               (target->WriteStoredData(block.data(), rest, target_position + copied) == rest));
+                }
+            }
+            bytes_written += count;
+            this->ReportProgress(count);
+        }
+        position += piece.length;
+    }
+
+    // Set the size (zeros at the end are left as a hole) and sync the data once
+    if (success) success = target->TruncateStoredData(size);
+    #if defined(_WIN32) || defined(__WIN32__)
+        if (success) success = (_commit(_fileno(target->file_handle_)) == 0);
+    #else
+        if (success) success = (fdatasync(fileno(target->file_handle_)) == 0);
+    #endif
+    this->progress_ = nullptr;
+
+    // Delete an incomplete file
+    if (!success)
+    {
+        target.reset();
+        remove(file_name);
+        return false;
+    }
+
+    // Switch to the new file, taking over its handle (the file is not opened again)
+    const auto use_overlay = static_cast<bool>(this->overlay_);
+    const auto file_cursor = (this->UsesVirtualCursor()) ? this->file_cursor_ : _ftelli64(this->file_handle_);
+    auto file_handle = target->file_handle_;
+    target->file_handle_ = nullptr;
+    this->Close();
+    this->file_name_ = std::move(new_file_name);
+    this->file_handle_ = file_handle;
+    this->file_attribute_ = TFileAttribute::NORMAL;
+    this->file_cursor_ = file_cursor;
+    this->file_size_ = -1;
+    this->hole_map_valid_ = false;
+    this->AttachHandle(TFileMode::CREATE);
+    if (!this->UsesVirtualCursor()) _fseeki64(this->file_handle_, file_cursor, SEEK_SET);
+
+    // Collect the following changes in memory again
+    if (use_overlay) this->EnableOverlay();
+    return true;
+}
+
+/**
+ * Returns true if the overlay holds changes that are not yet saved (see Save()), false otherwise.
+ * @return true if there are unsaved changes, false otherwise.
+ */
+bool TFile::IsModified() const noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    return this->IsOverlayed();
+}
+
+/**
+ * Writes the specified number of bytes at the specified file position in blocks of up to HE_FILE_SAVE_BLOCK_SIZE bytes.
+ * If the buffer is shorter than the data, the buffer is written repeatedly. The caller must hold the lock.
+ * @param buffer The buffer with the data.
+ * @param buffer_length The length of the buffer.
+ * @param length The number of bytes to write.
+ * @param position The zero-based file position to write at.
+ * @return true on success, false otherwise.
+ */
+bool TFile::WriteStoredRange(const unsigned char* buffer, int64_t buffer_length, int64_t length, int64_t position) noexcept
+{
+    int64_t bytes_written = 0;
+    while (bytes_written < length)
+    {
+        const auto offset = bytes_written % buffer_length;
+        const auto count = static_cast<uint32_t>(hedit_min(hedit_min(length - bytes_written, buffer_length - offset), static_cast<int64_t>(HE_FILE_SAVE_BLOCK_SIZE)));
+        if (this->WriteStoredData(&buffer[offset], count, position + bytes_written) != count) return false;
+        bytes_written += count;
+        this->ReportProgress(count);
+    }
+    return true;
+}
+
+/**
+ * Sets the specified range of the file to zeros, by punching a hole into the file if possible (see PunchStoredRange()),
+ * or by writing zeros otherwise. The caller must hold the lock.
+ * @param position The zero-based file position of the range.
+ * @param length The length of the range.
+ * @param zeros The buffer with the zeros to write (the length of the range or a multiple of the block size).
+ * @return true on success, false otherwise.
+ */
+bool TFile::ClearStoredRange(int64_t position, int64_t length, const std::vector<unsigned char>& zeros) noexcept
+{
+    if ((length >= HE_FILE_CACHE_PAGE_SIZE) && (this->PunchStoredRange(position, length)))
+    {
+        this->ReportProgress(length);
+        return true;
+    }
+    return this->WriteStoredRange(zeros.data(), static_cast<int64_t>(zeros.size()), length, position);
+}
+
+/**
+ * Deallocates the specified range of the file, so that it reads as zeros (fallocate() with FALLOC_FL_PUNCH_HOLE,
+ * Linux only). This takes no time and frees the disk space. The range must be within the file.
+ * The caller must hold the lock.
+ * @param position The zero-based file position of the range.
+ * @param length The length of the range.
+ * @return true on success, false if not supported.
+ */
+bool TFile::PunchStoredRange(int64_t position, int64_t length) noexcept
+{
+    #if defined(__linux__) && defined(FALLOC_FL_PUNCH_HOLE)
+        // Only regular files that are not accessed via direct I/O can be changed
+        struct stat file_info = {};
+        const auto handle = fileno(this->file_handle_);
+        if ((this->direct_handle_ >= 0) || (fstat(handle, &file_info) != 0) || (!S_ISREG(file_info.st_mode)) || (position + length > file_info.st_size)) return false;
+
+        // The pending data must be written first, it may be within the range
+        if (!this->Flush()) return false;
+        if (fallocate(handle, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, position, length) != 0) return false;
+
+        // The file was changed without the file object
+        this->ResetStoredState();
+        return true;
+    #else
+        static_cast<void>(position);
+        static_cast<void>(length);
+        return false;
+    #endif
+}
+
+/**
+ * Copies the specified range of the file to another position of the file, block by block. If the ranges overlap,
+ * the blocks are copied in the order that reads each block before it is overwritten. The caller must hold the lock.
+ * @param source The file position of the data.
+ * @param target The new file position of the data.
+ * @param length The number of bytes to copy.
+ * @param block The buffer for copying.
+ * @return true on success, false otherwise.
+ */
+bool TFile::MoveStoredData(int64_t source, int64_t target, int64_t length, std::vector<unsigned char>& block) noexcept
+{
+    int64_t bytes_moved = 0;
+    while (bytes_moved < length)
+    {
+        // Copy from the end of the range, if the data moves towards the end of the file
+        const auto count = static_cast<uint32_t>(hedit_min(length - bytes_moved, static_cast<int64_t>(block.size())));
+        const auto offset = (target > source) ? (length - bytes_moved - count) : bytes_moved;
+        if (this->ReadStoredData(block.data(), count, source + offset) != count) return false;
+        if (this->WriteStoredData(block.data(), count, target + offset) != count) return false;
+        bytes_moved += count;
+        this->ReportProgress(count);
+    }
+    return true;
+}
+
+/**
+ * Moves the pieces of the file without copying the data, by inserting and collapsing ranges of the file (fallocate()
+ * with FALLOC_FL_INSERT_RANGE and FALLOC_FL_COLLAPSE_RANGE, Linux only). This is possible where a piece moved by a
+ * multiple of the file system block size and both its old and new position are block-aligned, e.g. after inserting or
+ * erasing a few blocks of a large file. A range is only collapsed if it contains no data of the pieces in front.
+ * Each change moves all following data, so the file offsets of the following pieces are updated. The remaining moves
+ * are left to the copying. If the file system does not support changing ranges, nothing is changed.
+ * The caller must hold the lock.
+ * @param pieces The pieces of the changed content (the file offsets are updated).
+ */
+void TFile::ShiftStoredData(std::vector<TPiece>& pieces) noexcept
+{
+    #if defined(__linux__) && defined(FALLOC_FL_INSERT_RANGE) && defined(FALLOC_FL_COLLAPSE_RANGE)
+        // Only regular files that are not accessed via direct I/O can be changed
+        struct stat file_info = {};
+        const auto handle = fileno(this->file_handle_);
+        if ((this->direct_handle_ >= 0) || (fstat(handle, &file_info) != 0) || (!S_ISREG(file_info.st_mode)) || (file_info.st_blksize <= 0)) return;
+        const auto block_size = static_cast<int64_t>(file_info.st_blksize);
+
+        // The pending data must be written first, its position is moved as well
+        if (!this->Flush()) return;
+
+        // Insert a range in front of each aligned piece that moved towards the end by whole blocks,
+        // and collapse the range in front of each aligned piece that moved towards the start by whole blocks
+        int64_t position = 0;
+        int64_t shift = 0;
+        int64_t data_end = 0;
+        auto insert_supported = true;
+        auto collapse_supported = true;
+        auto changed = false;
+        for (auto& piece : pieces)
+        {
+            if (piece.source == TPieceSource::FILE)
+            {
+                piece.offset += shift;
+                const auto distance = position - piece.offset;
+                if (((distance % block_size) == 0) && ((position % block_size) == 0))
+                {
+                    auto success = false;
+                    if ((insert_supported) && (distance > 0))
+                    {
+                        success = (fallocate(handle, FALLOC_FL_INSERT_RANGE, piece.offset, distance) == 0);
+                        insert_supported = success;
+                    }
+                    else if ((collapse_supported) && (distance < 0) && (position >= data_end))
+                    {
+                        success = (fallocate(handle, FALLOC_FL_COLLAPSE_RANGE, position, -distance) == 0);
+                        collapse_supported = success;
+                    }
+                    if (success)
+                    {
+                        piece.offset += distance;
+                        shift += distance;
+                        changed = true;
+                    }
+                }
+                data_end = piece.offset + piece.length;
+            }
+            position += piece.length;
+        }
+
+        // The file was changed without the file object
+        if (changed) this->ResetStoredState();
+    #else
+        static_cast<void>(pieces);
+    #endif
+}
+
+/**
+ * Fills the specified buffer with repeated copies of the specified pattern. A single byte is set at once, longer
+ * patterns are copied once and then the filled part is doubled until the buffer is full, so that large blocks are
+ * copied (with the vector instructions of memcpy()) instead of the pattern.
+ * @param buffer The buffer to fill.
+ * @param length The length of the buffer.
+ * @param pattern The pattern.
+ * @param pattern_length The length of the pattern.
+ */
+void TFile::ReplicatePattern(unsigned char* buffer, std::size_t length, const unsigned char* pattern, std::size_t pattern_length) noexcept
+{
+    // A single byte is set at once
+    if (pattern_length == 1)
+    {
+        memset(buffer, pattern[0], length);
+        return;
+    }
+
+    // Copy the pattern once, then double the filled part
+    auto filled = hedit_min(pattern_length, length);
+    memcpy(buffer, pattern, filled);
+    while (filled < length)
+    {
+        const auto count = hedit_min(filled, length - filled);
+        memcpy(&buffer[filled], buffer, count);
+        filled += count;
+    }
+}
+
+/**
+ * Starts taking the snapshot of the file, if enabled and not yet started (see EnableSnapshot()).
+ * The caller must hold the lock.
+ */
+void TFile::StartSnapshot() noexcept
+{
+    // Check if the snapshot is to be taken
+    if ((this->snapshot_name_.IsEmpty()) || (this->snapshot_)) return;
+
+    // Write the pending data, so that the snapshot is up to date
+    if (!this->Flush()) return;
+
+    // Clone or copy the file
+    try
+    {
+        this->snapshot_.reset(new TFileSnapshot(this->file_name_, this->snapshot_name_));
+    }
+    catch (const std::bad_alloc&)
+    {
+        return;
+    }
+    this->snapshot_->Start(this->GetStoredSize());
+}
+
+/**
+ * Ensures that the snapshot of the file is complete before the file is changed, if enabled (see EnableSnapshot()).
+ * The caller must hold the lock.
+ * @param progress The receiver of the progress of the copy (nullptr if not required).
+ * @return true if the file may be changed, false if the snapshot failed.
+ */
+bool TFile::CompleteSnapshot(TFileProgress* progress) noexcept
+{
+    if (this->snapshot_name_.IsEmpty()) return true;
+    this->StartSnapshot();
+    return ((this->snapshot_) && (this->snapshot_->Wait(progress)));
+}
+
+/**
+ * Reports the progress of the running save operation (see Save()).
+ * @param length The number of bytes that were processed since the last report.
+ */
+void TFile::ReportProgress(int64_t length) noexcept
+{
+    this->progress_done_ += length;
+    if (this->progress_ != nullptr) this->progress_->Progress(this->progress_done_, this->progress_total_);
+}
+
+/**
+ * Truncates the file to the specified size and drops all cached data. The caller must hold the lock.
+ * @param size The new size of the file.
+ * @return true on success, false otherwise.
+ */
+bool TFile::TruncateStoredData(int64_t size) noexcept
+{
+    // Write the pending data first and release the mapping (the cut off pages must not be accessed)
+    if (!this->Flush()) return false;
+    const auto is_mapped = (this->file_mapping_ != nullptr);
+    this->UnmapFile();
+
+    // Truncate the file
+    #if defined(_WIN32) || defined(__WIN32__)
+        const auto success = (_chsize_s(_fileno(this->file_handle_), size) == 0);
+    #else
+        const auto success = (ftruncate(fileno(this->file_handle_), size) == 0);
+    #endif
+
+    // Forget the content and map the remaining file again
+    this->ResetStoredState();
+    if (is_mapped) this->MapFile();
+    return success;
+}
+
+/**
+ * Copies the specified range of the file to the specified target file within the kernel, if both files are
+ * regular files that are accessed via the system cache (Linux only). copy_file_range() is used if supported,
+ * which may even share the data blocks on copy-on-write file systems, otherwise sendfile(). Both avoid copying
+ * the data through user space buffers. The caller must hold the locks of both files.
+ * @param target The target file.
+ * @param position The zero-based file position of the data.
+ * @param length The number of bytes to copy.
+ * @param target_position The zero-based position in the target file.
+ * @return The number of bytes copied (0 if the data must be copied via a buffer).
+ */
+int64_t TFile::CopyStoredData(TFile* target, int64_t position, int64_t length, int64_t target_position) noexcept
+{
+    #if defined(__linux__)
+        // Both files must be regular files that are not accessed via direct I/O
+        struct stat source_info = {};
+        struct stat target_info = {};
+        const auto source_handle = fileno(this->file_handle_);
+        const auto target_handle = fileno(target->file_handle_);
+        if ((this->direct_handle_ >= 0) || (target->direct_handle_ >= 0) || (this->gzip_) || (target->gzip_)) return 0;
+        if ((fstat(source_handle, &source_info) != 0) || (fstat(target_handle, &target_info) != 0)) return 0;
+        if ((!S_ISREG(source_info.st_mode)) || (!S_ISREG(target_info.st_mode))) return 0;
+
+        // The pending data must be written first, the kernel copies from the file
+        if (!this->Flush()) return 0;
+
+        // Copy via copy_file_range(), falling back to sendfile() if the files do not support it (e.g. on different file systems)
+        auto source_offset = static_cast<off_t>(position);
+        auto target_offset = static_cast<off_t>(target_position);
+        #if defined(HE_HAS_COPY_FILE_RANGE)
+            auto use_sendfile = false;
+        #else
+            const auto use_sendfile = true;
+        #endif
+        const auto old_pos = lseek(target_handle, 0, SEEK_CUR);
+        int64_t bytes_copied = 0;
+        while (bytes_copied < length)
+        {
+            const auto count = static_cast<std::size_t>(hedit_min(length - bytes_copied, static_cast<int64_t>(HE_FILE_KERNEL_COPY_SIZE)));
+            ssize_t result = -1;
+            if (!use_sendfile)
+            {
+                #if defined(HE_HAS_COPY_FILE_RANGE)
+                    result = copy_file_range(source_handle, &source_offset, target_handle, &target_offset, count, 0);
+                    if ((result < 0) && (errno == EINTR)) continue;
+                    if ((result < 0) && (bytes_copied == 0))
+                    {
+                        use_sendfile = true;
+                        continue;
+                    }
+                #endif
+            }
+            else
+            {
+                // sendfile() writes at the offset of the target handle
+                if (lseek(target_handle, target_offset, SEEK_SET) < 0) break;
+                result = sendfile(target_handle, source_handle, &source_offset, count);
+                if ((result < 0) && (errno == EINTR)) continue;
+                if (result > 0) target_offset += result;
+            }
+            if (result <= 0) break;
+            bytes_copied += result;
+        }
+
+        // Restore the offset of the target handle, the target content was changed without the target file object
+        if (old_pos >= 0) lseek(target_handle, old_pos, SEEK_SET);
+        if (bytes_copied > 0) target->ResetStoredState();
+        return bytes_copied;
+    #else
+        static_cast<void>(target);
+        static_cast<void>(position);
+        static_cast<void>(length);
+        static_cast<void>(target_position);
+        return 0;
+    #endif
+}
+
+/**
+ * Copies the specified range of the (changed) content to the specified target file via a buffer, block by block.
+ * The caller must hold the locks of both files.
+ * @param target The target file.
+ * @param position The zero-based position of the data.
+ * @param length The number of bytes to copy.
+ * @param target_position The zero-based position in the target file.
+ * @return The number of bytes copied.
+ */
+int64_t TFile::CopyBuffered(TFile* target, int64_t position, int64_t length, int64_t target_position) noexcept
+{
+    // Create the buffer
+    std::vector<unsigned char> block;
+    try
+    {
+        block.resize(static_cast<std::size_t>(hedit_min(length, static_cast<int64_t>(HE_FILE_SAVE_BLOCK_SIZE))));
+    }
+    catch (const std::bad_alloc&)
+    {
+        return 0;
+    }
+
+    // Copy block by block
+    int64_t bytes_copied = 0;
+    while (bytes_copied < length)
+    {
+        const auto count = static_cast<uint32_t>(hedit_min(length - bytes_copied, static_cast<int64_t>(block.size())));
+        const auto bytes_read = this->ReadData(block.data(), count, position + bytes_copied);
+        const auto bytes_written = (bytes_read > 0) ? target->WriteStoredData(block.data(), bytes_read, target_position + bytes_copied) : 0;
+        bytes_copied += bytes_written;
+        if ((bytes_read < count) || (bytes_written < bytes_read)) break;
+    }
+    return bytes_copied;
+}
+
+/**
+ * Forgets everything that is known about the file content (the size, the holes, the pages read ahead and the cached pages),
+ * after the file was changed without the file object. The caller must hold the lock.
+ */
+void TFile::ResetStoredState() noexcept
+{
+    this->file_size_ = -1;
+    this->hole_map_valid_ = false;
+    if (this->read_ahead_) this->read_ahead_->Cancel();
+    if (this->file_cache_)
+    {
+        std::lock_guard<std::recursive_mutex> cache_lock(this->file_cache_->GetLock());
+        this->file_cache_->Invalidate();
+    }
+
+    // The mapping may not cover the whole file any longer
+    if (this->file_mapping_ != nullptr)
+    {
+        this->UnmapFile();
+        this->MapFile();
+    }
+}
+
+/**
+ * Reads one line of text from the current position in the file.
+ * If no data can be read, an empty string object is returned.
+ * @return A string with the read line.
+ */
+TString TFile::ReadLine()
+{
+    TString buffer;
+    unsigned char tempbuffer[2];
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Initialize the temporary buffer
+    tempbuffer[1] = 0;
+
+    // Process the whole file
+    while (!this->IsEOF())
+    {
+        // Read one byte
+        if (this->Read(tempbuffer, 1) < 1) continue;
+
+        // Skip CR
+        if (tempbuffer[0] == 0x0D) continue;
+
+        // End with LF
+        if (tempbuffer[0] == 0x0A) break;
+
+        // Append the character
+        buffer += static_cast<char>(tempbuffer[0]);
+    }
+
+    // Return the string
+    return buffer;
+}
+
+/**
+ * Returns true if end of file is reached, false otherwise.
+ * @return true if end of file is reached, false otherwise.
+ */
+bool TFile::IsEOF() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // A closed file will be reported as as eof
+    if (this->file_handle_ == nullptr) return true;
+
+    if (this->UsesVirtualCursor())
+    {
+        return (this->file_cursor_ >= this->FileSize());
+    }
+    else
+    {
+        return (feof(this->file_handle_) != 0);
+    }
+}
+
+/**
+ * Returns true if the file is read-only, false otherwise.
+ * @return true if the file is read-only, false otherwise.
+ */
+bool TFile::IsReadOnly() const noexcept
+{
+    return (this->file_attribute_ == TFileAttribute::READ_ONLY);
+}
+
+/**
+ * Returns true if the file content is read via a memory mapping, false otherwise.
+ * @return true if the file content is read via a memory mapping, false otherwise.
+ */
+bool TFile::IsMapped() const noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    return (this->file_mapping_ != nullptr);
+}
+
+/**
+ * Returns true if the file is a block device that is accessed via direct (unbuffered) I/O, false otherwise.
+ * @return true if direct I/O is used, false otherwise.
+ */
+bool TFile::IsDirect() const noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    return (this->direct_handle_ >= 0);
+}
+
+/**
+ * Returns the size of the associated file. The file must be open, otherwise 0 is returned.
+ * The size is cached, it is only queried from the operating system, if the file was opened or if a read or write
+ * operation indicated a change of the file (see RefreshFileSize()).
+ * @return The size of the associated file.
+ */
+int64_t TFile::FileSize() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Ensure the file is open
+    if (this->file_handle_ == nullptr) return 0;
+
+    // The size of the changed content is known by the overlay
+    if (this->IsOverlayed()) return this->overlay_->Size();
+
+    // Return file size
+    return this->GetStoredSize();
+}
+
+/**
+ * Returns true if the file is a stream whose data is still arriving (see TFileSpool) or a gzip file whose index is
+ * being built (see TFileGzip), false otherwise.
+ * @return true if the stream is still arriving, false otherwise.
+ */
+bool TFile::IsStreaming() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    return (((this->spool_) && (!this->spool_->IsDone())) || ((this->gzip_) && (!this->gzip_->IsDone())));
+}
+
+/**
+ * Returns true if the decompressed content of a gzip file is opened (see TFileMode::DECOMPRESS), false otherwise.
+ * @return true if the file is read decompressed, false otherwise.
+ */
+bool TFile::IsCompressed() const noexcept
+{
+    return static_cast<bool>(this->gzip_);
+}
+
+/**
+ * Waits until the file has reached the specified size, if it is a stream whose data is still arriving.
+ * @param size The size that is needed.
+ * @param timeout The maximum time to wait (in ms), -1 to wait until the data has arrived.
+ * @return The size of the file (less than the specified size, if the stream has ended or the time has elapsed).
+ */
+int64_t TFile::WaitForSize(int64_t size, int32_t timeout) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Wait for the data
+    if (this->spool_) this->spool_->WaitFor(size, timeout);
+    if (this->gzip_) this->gzip_->WaitFor(size, timeout);
+    return this->FileSize();
+}
+
+/**
+ * Returns the size of the opened file, without the changes that are collected by the overlay. The caller must hold the lock.
+ * @return The size of the file.
+ */
+int64_t TFile::GetStoredSize() noexcept
+{
+    // The size of a stream is the number of bytes that have arrived (the temporary file is mapped, once the stream has ended)
+    if (this->spool_)
+    {
+        const auto length = this->spool_->Length();
+        if (length != this->file_size_) this->hole_map_valid_ = false;
+        this->file_size_ = length;
+        if ((this->use_mapping_) && (this->file_mapping_ == nullptr) && (this->spool_->IsDone())) this->MapFile();
+        return this->file_size_;
+    }
+
+    // The size of a gzip file is the length of the decompressed data that is indexed so far
+    if (this->gzip_)
+    {
+        this->file_size_ = this->gzip_->Length();
+        return this->file_size_;
+    }
+
+    // The file may have been changed via another file object (that shares the cache)
+    if (this->file_cache_)
+    {
+        std::lock_guard<std::recursive_mutex> cache_lock(this->file_cache_->GetLock());
+        this->CheckCacheVersion();
+    }
+
+    // Query the size, if unknown
+    if (this->file_size_ < 0) this->file_size_ = this->QueryFileSize();
+
+    // Return file size
+    return this->file_size_;
+}
+
+/**
+ * Queries the size of the associated file from the operating system, e.g. after the file was changed externally.
+ * If the size has changed, the file is mapped again.
+ * @return The size of the associated file (0 if the file is not open).
+ */
+int64_t TFile::RefreshFileSize() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Ensure the file is open
+    if (this->file_handle_ == nullptr) return 0;
+
+    // Forget the cached size (and the holes)
+    this->file_size_ = -1;
+    this->hole_map_valid_ = false;
+
+    // Map the file again, if it was truncated or extended
+    if ((this->file_mapping_ != nullptr) && (this->GetStoredSize() != this->mapping_length_))
+    {
+        this->UnmapFile();
+        this->MapFile();
+    }
+
+    // Query the size
+    return this->FileSize();
+}
+
+/**
+ * Retrieves the extent of the file that contains the specified position. An extent is either a hole of a sparse file
+ * (that reads as zeros) or a range of data. Pending writes are treated as data. Holes are detected via SEEK_HOLE and
+ * SEEK_DATA, if supported by the system and the file system, otherwise the whole file is a single data extent.
+ * If the overlay holds changes, the inserted zeros are holes and the other changed data is data.
+ * @param position The zero-based file position.
+ * @param extent_start Receives the file offset of the first byte of the extent.
+ * @param extent_end Receives the file offset behind the last byte of the extent.
+ * @return true if the position lies within a hole, false if it lies within data (or behind the end of the file,
+ * in which case the extent is empty).
+ */
+bool TFile::GetExtent(int64_t position, int64_t& extent_start, int64_t& extent_end) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Without changes, the extents of the file are returned
+    if (!this->IsOverlayed()) return this->GetStoredExtent(position, extent_start, extent_end);
+
+    // Find the piece that contains the position
+    TPiece piece = {};
+    int64_t piece_start = 0;
+    if (!this->overlay_->Find(position, piece, piece_start))
+    {
+        extent_start = position;
+        extent_end = position;
+        return false;
+    }
+
+    // Added data and zeros form an extent of their own
+    if (piece.source != TPieceSource::FILE)
+    {
+        extent_start = piece_start;
+        extent_end = piece_start + piece.length;
+        return (piece.source == TPieceSource::ZERO);
+    }
+
+    // Translate the extent of the file that contains the position, limited to the piece
+    const auto is_hole = this->GetStoredExtent(piece.offset + (position - piece_start), extent_start, extent_end);
+    extent_start = piece_start + (hedit_max(extent_start, piece.offset) - piece.offset);
+    extent_end = piece_start + (hedit_min(extent_end, piece.offset + piece.length) - piece.offset);
+    return is_hole;
+}
+
+/**
+ * Retrieves the extent of the file that contains the specified file position, without the changes that are collected
+ * by the overlay (see GetExtent()). The caller must hold the lock.
+ * @param position The zero-based file position.
+ * @param extent_start Receives the file offset of the first byte of the extent.
+ * @param extent_end Receives the file offset behind the last byte of the extent.
+ * @return true if the position lies within a hole, false otherwise.
+ */
+bool TFile::GetStoredExtent(int64_t position, int64_t& extent_start, int64_t& extent_end) noexcept
+{
+    // Ensure a valid position
+    const auto file_size = this->GetStoredSize();
+    if ((position < 0) || (position >= file_size))
+    {
+        extent_start = position;
+        extent_end = position;
+        return false;
+    }
+
+    // Update the holes, if required
+    if (!this->hole_map_valid_) this->BuildHoleMap();
+
+    // Find the first hole that ends behind the position
+    const auto hole = std::upper_bound(this->hole_map_.begin(), this->hole_map_.end(), position, [](int64_t value, const TFileHole& item) { return (value < item.end); });
+    auto is_hole = ((hole != this->hole_map_.end()) && (hole->start <= position));
+    if (is_hole)
+    {
+        extent_start = hole->start;
+        extent_end = hole->end;
+    }
+    else
+    {
+        extent_start = (hole == this->hole_map_.begin()) ? 0 : std::prev(hole)->end;
+        extent_end = (hole == this->hole_map_.end()) ? file_size : hole->start;
+    }
+
+    // Pending writes are data (the extent is reduced to the part before or behind the pending data)
+    const auto dirty_end = this->dirty_start_ + static_cast<int64_t>(this->dirty_data_.size());
+    if ((is_hole) && (!this->dirty_data_.empty()) && (this->dirty_start_ < extent_end) && (dirty_end > extent_start))
+    {
+        if (position < this->dirty_start_)
+        {
+            extent_end = this->dirty_start_;
+        }
+        else if (position >= dirty_end)
+        {
+            extent_start = dirty_end;
+        }
+        else
+        {
+            extent_start = this->dirty_start_;
+            extent_end = dirty_end;
+            is_hole = false;
+        }
+    }
+
+    // Return if the position lies within a hole
+    return is_hole;
+}
+
+/**
+ * Returns the holes of the file (sorted by offset). The pending writes are not taken into account.
+ * @return The holes of the file (empty, if the file is not sparse or if holes cannot be detected).
+ */
+std::vector<TFileHole> TFile::GetHoleMap()
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Update the holes, if required
+    if ((this->file_handle_ != nullptr) && (!this->hole_map_valid_)) this->BuildHoleMap();
+
+    // Return a copy of the holes
+    return this->hole_map_;
+}
+
+/**
+ * Collects the holes of the opened file by walking through the file via SEEK_HOLE and SEEK_DATA. The offset of the file
+ * descriptor is restored afterwards, so that the position of the stdio stream is not changed. The caller must hold the lock.
+ */
+void TFile::BuildHoleMap() noexcept
+{
+    // Forget the old holes
+    this->hole_map_.clear();
+    this->hole_map_valid_ = true;
+
+    #if defined(SEEK_HOLE) && defined(SEEK_DATA)
+        // Devices (e.g. direct I/O) and the decompressed content of gzip files have no holes
+        if ((this->direct_handle_ >= 0) || (this->gzip_)) return;
+        const auto handle = fileno(this->file_handle_);
+        const auto file_size = this->GetStoredSize();
+        const auto old_pos = lseek(handle, 0, SEEK_CUR);
+        if (old_pos < 0) return;
+
+        // Find the holes (an unsupported file system reports a single hole at the end of the file)
+        int64_t position = 0;
+        while (position < file_size)
+        {
+            const int64_t hole_start = lseek(handle, position, SEEK_HOLE);
+            if ((hole_start < 0) || (hole_start >= file_size)) break;
+            int64_t hole_end = lseek(handle, hole_start, SEEK_DATA);
+            if ((hole_end < 0) || (hole_end > file_size)) hole_end = file_size;
+            try
+            {
+                this->hole_map_.push_back({ hole_start, hole_end });
+            }
+            catch (const std::bad_alloc&)
+            {
+                this->hole_map_.clear();
+                break;
+            }
+            position = hole_end;
+        }
+
+        // Restore the offset of the file descriptor
+        lseek(handle, old_pos, SEEK_SET);
+    #endif
+}
+
+/**
+ * Queries the size of the opened file. Regular files are queried via fstat, block devices via the BLKGETSIZE64 ioctl,
+ * all other files by seeking to the end of the file.
+ * @return The size of the opened file.
+ */
+int64_t TFile::QueryFileSize() noexcept
+{
+    #if defined(_WIN32) || defined(__WIN32__)
+        // Query the size of disk files directly
+        LARGE_INTEGER file_size = {};
+        const auto os_handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(this->file_handle_)));
+        if ((os_handle != INVALID_HANDLE_VALUE) && (GetFileType(os_handle) == FILE_TYPE_DISK) && (GetFileSizeEx(os_handle, &file_size) != FALSE)) return file_size.QuadPart;
+    #else
+        // Query the size of regular files and block devices directly
+        struct stat file_info = {};
+        if (fstat(fileno(this->file_handle_), &file_info) == 0)
+        {
+            if (S_ISREG(file_info.st_mode)) return file_info.st_size;
+            #if defined(BLKGETSIZE64)
+            uint64_t device_size = 0;
+            if ((S_ISBLK(file_info.st_mode)) && (ioctl(fileno(this->file_handle_), BLKGETSIZE64, &device_size) == 0)) return static_cast<int64_t>(device_size);
+            #endif
+        }
+    #endif
+
+    // Remember the old file pos
+    const auto old_pos = _ftelli64(this->file_handle_);
+
+    // Jump to eof
+    _fseeki64(this->file_handle_, 0, SEEK_END);
+
+    // Retrieve current position, that equals to file length
+    const auto length = _ftelli64(this->file_handle_);
+
+    // Set old position
+    _fseeki64(this->file_handle_, old_pos, SEEK_SET);
+
+    // Return file size
+    return length;
+}
+
+/**
+ * Assigns the cache of the opened file. All file objects that access the same file (or device) share one cache, so that
+ * the data is cached only once and the changes of one file object are visible to the others. The caller must hold the lock.
+ * @param mode The file mode that was used for opening the file (see TFileMode).
+ */
+void TFile::AttachCache(TFileMode mode) noexcept
+{
+    // Release the cache of the previous file (if any)
+    this->DetachCache();
+
+    // Get the shared cache of the file (files that cannot be identified, e.g. pipes, and the decompressed content of gzip files use a private cache)
+    uint64_t device = 0;
+    uint64_t inode = 0;
+    try
+    {
+        if ((!this->gzip_) && (this->QueryFileId(device, inode)))
+            this->file_cache_ = TFileCacheRegistry::Acquire(device, inode, this->cache_size_);
+        else
+            this->file_cache_ = std::make_shared<TFileCache>(this->cache_size_);
+    }
+    catch (const std::bad_alloc&)
+    {
+        // Without cache, the file is read directly
+        this->file_cache_.reset();
+        return;
+    }
+
+    // A created file is truncated, so the cached data of the other file objects is outdated
+    std::lock_guard<std::recursive_mutex> cache_lock(this->file_cache_->GetLock());
+    if (mode == TFileMode::CREATE) this->file_cache_->Invalidate();
+    this->cache_version_ = this->file_cache_->GetVersion();
+}
+
+/**
+ * Releases the cache of the file (and the page that is pinned by the last view). The caller must hold the lock.
+ */
+void TFile::DetachCache() noexcept
+{
+    // Ensure a cache is used
+    if (!this->file_cache_) return;
+
+    // Release the pinned page
+    if (this->pinned_page_ >= 0)
+    {
+        std::lock_guard<std::recursive_mutex> cache_lock(this->file_cache_->GetLock());
+        this->file_cache_->Unpin(this->pinned_page_);
+    }
+    this->pinned_page_ = -1;
+
+    // Release the cache (the last file object of a file frees the cache)
+    this->file_cache_.reset();
+}
+
+/**
+ * Checks if the cached content was changed by another file object (that shares the cache). If so, the file size and
+ * the holes are queried again and the pages that are read ahead are dropped. The caller must hold the lock of the cache.
+ */
+void TFile::CheckCacheVersion() noexcept
+{
+    // Check if the content was changed
+    const auto version = this->file_cache_->GetVersion();
+    if (version == this->cache_version_) return;
+    this->cache_version_ = version;
+
+    // Forget everything that may be outdated now
+    this->file_size_ = -1;
+    this->hole_map_valid_ = false;
+    if (this->read_ahead_) this->read_ahead_->Cancel();
+
+    // Map the file again, the other file object may have truncated or extended it
+    if (this->file_mapping_ != nullptr)
+    {
+        this->UnmapFile();
+        this->MapFile();
+    }
+}
+
+/**
+ * Patches the written data into the cached pages. The own changes do not count as changes by other file objects.
+ * @param position The file offset the data was written to.
+ * @param buffer The data that was written.
+ * @param length The number of bytes that were written.
+ */
+void TFile::UpdateCache(int64_t position, const unsigned char* buffer, uint32_t length) noexcept
+{
+    std::lock_guard<std::recursive_mutex> cache_lock(this->file_cache_->GetLock());
+
+    // Update the pages (keeping a pending change of another file object visible to CheckCacheVersion())
+    const auto is_current = (this->file_cache_->GetVersion() == this->cache_version_);
+    this->file_cache_->Update(position, buffer, length);
+    if (is_current) this->cache_version_ = this->file_cache_->GetVersion();
+}
+
+/**
+ * Queries the unique identification of the opened file, which is the device and the inode for regular files (under
+ * Windows the volume serial number and the file index). Block devices are identified by their device number.
+ * @param device Receives the device that holds the file.
+ * @param inode Receives the inode of the file (0 for block devices).
+ * @return true on success, false if the file cannot be identified (e.g. pipes).
+ */
+bool TFile::QueryFileId(uint64_t& device, uint64_t& inode) const noexcept
+{
+    #if defined(_WIN32) || defined(__WIN32__)
+        // Only disk files can be identified
+        BY_HANDLE_FILE_INFORMATION file_info = {};
+        const auto os_handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(this->file_handle_)));
+        if ((os_handle == INVALID_HANDLE_VALUE) || (GetFileType(os_handle) != FILE_TYPE_DISK)) return false;
+        if (GetFileInformationByHandle(os_handle, &file_info) == FALSE) return false;
+        device = file_info.dwVolumeSerialNumber;
+        inode = (static_cast<uint64_t>(file_info.nFileIndexHigh) << 32) | file_info.nFileIndexLow;
+        return true;
+    #else
+        // Only regular files and block devices can be identified
+        struct stat file_info = {};
+        if (fstat(fileno(this->file_handle_), &file_info) != 0) return false;
+        if (S_ISREG(file_info.st_mode))
+        {
+            device = static_cast<uint64_t>(file_info.st_dev);
+            inode = static_cast<uint64_t>(file_info.st_ino);
+            return true;
+        }
+        if (S_ISBLK(file_info.st_mode))
+        {
+            device = static_cast<uint64_t>(file_info.st_rdev);
+            inode = 0;
+            return true;
+        }
+        return false;
+    #endif
+}
+
+/**
+ * Checks if the specified file is open in a file object that shares its cache (see TFileCacheRegistry).
+ * @param file_name The name of the file.
+ * @return true if the file is open in a cached file object, false otherwise (or if the file does not exist).
+ */
+bool TFile::IsFileShared(const char* file_name) noexcept
+{
+    #if defined(_WIN32) || defined(__WIN32__)
+        // Identify the file via a handle (only disk files can be identified)
+        const auto file_handle = _fsopen(file_name, "rb", _SH_DENYNO);
+        if (file_handle == nullptr) return false;
+        BY_HANDLE_FILE_INFORMATION file_info = {};
+        const auto os_handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file_handle)));
+        const auto identified = ((os_handle != INVALID_HANDLE_VALUE) && (GetFileType(os_handle) == FILE_TYPE_DISK) && (GetFileInformationByHandle(os_handle, &file_info) != FALSE));
+        fclose(file_handle);
+        if (!identified) return false;
+        const auto device = static_cast<uint64_t>(file_info.dwVolumeSerialNumber);
+        const auto inode = (static_cast<uint64_t>(file_info.nFileIndexHigh) << 32) | file_info.nFileIndexLow;
+    #else
+        // Identify the file without opening it (streams are not opened, block devices are identified by their device number)
+        struct stat file_info = {};
+        if (stat(file_name, &file_info) != 0) return false;
+        if ((!S_ISREG(file_info.st_mode)) && (!S_ISBLK(file_info.st_mode))) return false;
+        const auto device = static_cast<uint64_t>((S_ISBLK(file_info.st_mode)) ? file_info.st_rdev : file_info.st_dev);
+        const auto inode = (S_ISBLK(file_info.st_mode)) ? 0 : static_cast<uint64_t>(file_info.st_ino);
+    #endif
+
+    // Check if a cache is registered for the file
+    try
+    {
+        return TFileCacheRegistry::IsRegistered(device, inode);
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+/**
+ * Returns the cache page for the block starting at the specified file offset, reading the block from the file
+ * into a (recycled) page if it is not yet cached. The caller must hold the lock of the cache.
+ * @param page_start The file offset of the block (must be a multiple of HE_FILE_CACHE_PAGE_SIZE).
+ * @return The cache page or nullptr if no data can be read at the specified offset.
+ */
+TFileCachePage* TFile::LoadCachePage(int64_t page_start) noexcept
+{
+    // Move the pages that were read ahead into the cache
+    this->CollectReadAhead(page_start);
+
+    // Check, if the block is already cached
+    auto page = this->file_cache_->Find(page_start);
+    if (page != nullptr)
+    {
+        this->ScheduleReadAhead(page_start);
+        return page;
+    }
+
+    // Get a page for the block (if allocation fails, the cache is not usable)
+    try
+    {
+        page = this->file_cache_->Allocate(page_start);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+
+    // Read the data bytes from the device (direct I/O) or from the file
+    std::size_t bytes_read = 0;
+    if (this->direct_handle_ >= 0)
+    {
+        bytes_read = this->ReadDirect(page->data, HE_FILE_CACHE_PAGE_SIZE, page_start);
+    }
+    else
+    {
+        bytes_read = this->ReadFromHandle(page->data, HE_FILE_CACHE_PAGE_SIZE, page_start);
+    }
+    if (bytes_read == 0)
+    {
+        this->file_cache_->Discard(page_start);
+        return nullptr;
+    }
+
+    // Store the length of the cached block
+    page->length = static_cast<uint32_t>(bytes_read);
+
+    // Read the next pages ahead, if the file is scanned sequentially
+    this->ScheduleReadAhead(page_start);
+
+    // Return the page
+    return page;
+}
+
+/**
+ * Moves the pages that were read ahead into the cache. If the specified page is being read ahead, the function
+ * waits until the page is available, instead of reading the page a second time. The caller must hold the lock of the cache.
+ * @param page_start The file offset of the page that is to be accessed.
+ */
+void TFile::CollectReadAhead(int64_t page_start) noexcept
+{
+    // Check if pages were read ahead
+    if ((!this->read_ahead_) || (!this->read_ahead_->Wait(page_start))) return;
+
+    // Move the pages into the cache (the memory of the recycled pages is used for the next reads)
+    TFileCachePage block;
+    while (this->read_ahead_->Collect(block))
+    {
+        try
+        {
+            this->file_cache_->Adopt(block);
+        }
+        catch (const std::bad_alloc&)
+        {
+            // The block is dropped, it will be read again when needed
+        }
+        this->read_ahead_->Release(std::move(block));
+    }
+}
+
+/**
+ * Records the access of the specified page and, if the file is scanned sequentially, requests the
+ * next (not yet cached) pages in scan direction from the read-ahead engine. The caller must hold the lock of the cache.
+ * @param page_start The file offset of the accessed page.
+ */
+void TFile::ScheduleReadAhead(int64_t page_start) noexcept
+{
+    // Detect the scan direction
+    if (!this->read_ahead_) return;
+    const auto direction = this->read_ahead_->Track(page_start);
+    if (direction == 0) return;
+
+    // Request the pages in scan direction (up to the end of the file)
+    const auto file_size = this->GetStoredSize();
+    for (uint32_t index = 1; index <= this->read_ahead_->GetWindow(); index++)
+    {
+        const auto next_page = page_start + direction * static_cast<int64_t>(index) * HE_FILE_CACHE_PAGE_SIZE;
+        if ((next_page < 0) || ((file_size >= 0) && (next_page >= file_size))) break;
+        if (!this->file_cache_->Contains(next_page)) this->read_ahead_->Request(next_page);
+    }
+}
+
+/**
+ * Reads the specified number of bytes at the specified position from the cache into the specified buffer.
+ * If the data at the desired reading position is not yet cached, the LoadCachePage()
+ * function is called to cache the required data. Reads that cross a page boundary are assembled from
+ * multiple pages.
+ * @param buffer The buffer to read into.
+ * @param count The number of bytes to read.
+ * @param position The zero-based position to read at.
+ * @return The number of bytes that were read from the cache.
+ */
+uint32_t TFile::ReadFromCache(unsigned char* buffer, uint32_t count, int64_t position) noexcept
+{
+    // Nothing can be read before the file start
+    if (position < 0) return 0;
+
+    // Lock the cache and check for changes by other file objects
+    std::lock_guard<std::recursive_mutex> cache_lock(this->file_cache_->GetLock());
+    this->CheckCacheVersion();
+
+    // Copy the data page by page
+    uint32_t bytes_read = 0;
+    while (bytes_read < count)
+    {
+        // Get the page that holds the current position
+        const auto current_position = position + bytes_read;
+        const auto page_start = current_position - (current_position % HE_FILE_CACHE_PAGE_SIZE);
+        const auto page = this->LoadCachePage(page_start);
+        if (page == nullptr) break;
+
+        // Stop at the end of the cached data (end of file)
+        const auto offset = static_cast<uint32_t>(current_position - page_start);
+        if (offset >= page->length) break;
+
+        // Copy the available part
+        const auto bytes_to_copy = hedit_min(page->length - offset, count - bytes_read);
+        memcpy(&buffer[bytes_read], &page->data[offset], bytes_to_copy);
+        bytes_read += bytes_to_copy;
+
+        // A short page is the last page of the file
+        if (page->length < HE_FILE_CACHE_PAGE_SIZE) break;
+    }
+
+    // Return the number of bytes read
+    return bytes_read;
+}
+
+/**
+ * Maps the whole (opened) file read-only into memory. Only regular, non-empty files can be mapped,
+ * for pipes, devices and files that do not fit into the address space the function fails.
+ * @return true if the file was mapped, false otherwise.
+ */
+bool TFile::MapFile() noexcept
+{
+    // Ensure the file is open and not yet mapped
+    if ((this->file_handle_ == nullptr) || (this->file_mapping_ != nullptr)) return false;
+
+    #if defined(_WIN32) || defined(__WIN32__)
+        // Only disk files can be mapped
+        const auto os_handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(this->file_handle_)));
+        if ((os_handle == INVALID_HANDLE_VALUE) || (GetFileType(os_handle) != FILE_TYPE_DISK)) return false;
+
+        // Empty files and files larger than the address space cannot be mapped
+        LARGE_INTEGER file_size = {};
+        if ((GetFileSizeEx(os_handle, &file_size) == FALSE) || (file_size.QuadPart <= 0)) return false;
+        if (static_cast<uint64_t>(file_size.QuadPart) > SIZE_MAX) return false;
+
+        // Create the mapping object
+        this->mapping_handle_ = CreateFileMapping(os_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (this->mapping_handle_ == nullptr) return false;
+
+        // Map the whole file
+        auto mapping = MapViewOfFile(this->mapping_handle_, FILE_MAP_READ, 0, 0, 0);
+        if (mapping == nullptr)
+        {
+            CloseHandle(this->mapping_handle_);
+            this->mapping_handle_ = nullptr;
+            return false;
+        }
+        this->mapping_length_ = file_size.QuadPart;
+    #else
+        // Only regular files can be mapped
+        struct stat file_info = {};
+        if (fstat(fileno(this->file_handle_), &file_info) != 0) return false;
+        if (!S_ISREG(file_info.st_mode)) return false;
+
+        // Empty files and files larger than the address space cannot be mapped
+        if (file_info.st_size <= 0) return false;
+        if (static_cast<uint64_t>(file_info.st_size) > SIZE_MAX) return false;
+
+        // Map the whole file (shared, so that the writes via stdio are visible in the mapping)
+        auto mapping = mmap(nullptr, static_cast<std::size_t>(file_info.st_size), PROT_READ, MAP_SHARED, fileno(this->file_handle_), 0);
+        if (mapping == MAP_FAILED) return false;
+        this->mapping_length_ = file_info.st_size;
+    #endif
+
+    // Store the mapping
+    this->file_mapping_ = static_cast<unsigned char*>(mapping);
+
+    // Return success
+    return true;
+}
+
+/**
+ * Releases the memory mapping of the file (if any).
+ */
+void TFile::UnmapFile() noexcept
+{
+    // Ensure the file is mapped
+    if (this->file_mapping_ == nullptr) return;
+
+    #if defined(_WIN32) || defined(__WIN32__)
+        UnmapViewOfFile(this->file_mapping_);
+        CloseHandle(this->mapping_handle_);
+        this->mapping_handle_ = nullptr;
+    #else
+        munmap(this->file_mapping_, static_cast<std::size_t>(this->mapping_length_));
+    #endif
+
+    // Clear the mapping
+    this->file_mapping_ = nullptr;
+    this->mapping_length_ = 0;
+}
+
+/**
+ * Checks if the file is mapped, before the mapping is accessed. If the file was changed via another file object (that
+ * shares the cache), the file is mapped again (see CheckCacheVersion()). External changes of the size are picked up by
+ * RefreshFileSize(), a mapped page beyond the end of an externally truncated file is caught by ReadFromMapping().
+ * The caller must hold the lock.
+ * @return true if the file is mapped, false otherwise.
+ */
+bool TFile::CheckMapping() noexcept
+{
+    // Ensure the file is mapped
+    if (this->file_mapping_ == nullptr) return false;
+
+    // The file may have been changed via another file object (that shares the cache)
+    if (this->file_cache_)
+    {
+        std::lock_guard<std::recursive_mutex> cache_lock(this->file_cache_->GetLock());
+        this->CheckCacheVersion();
+    }
+    return (this->file_mapping_ != nullptr);
+}
+
+#if !(defined(_WIN32) || defined(__WIN32__))
+// The jump buffer of the guarded copy that runs on the current thread (nullptr, if no copy runs, volatile as it is read by the signal handler)
+static thread_local sigjmp_buf* volatile mapping_guard = nullptr;
+
+// The action for SIGBUS that was installed before the guard
+static struct sigaction previous_bus_action = {};
+
+/**
+ * Handles SIGBUS, which is raised if a mapped page beyond the end of a truncated file is accessed. A guarded copy
+ * (see CopyFromMapping()) is aborted, any other fault is passed on to the previously installed action.
+ * @param signal_number The number of the signal.
+ * @param info The information about the signal.
+ * @param context The context of the interrupted thread.
+ */
+static void HandleMappingFault(int signal_number, siginfo_t* info, void* context)
+{
+    // Abort the guarded copy
+    if (mapping_guard != nullptr) siglongjmp(*mapping_guard, 1);
+
+    // Pass the fault on to the previous handler
+    if ((previous_bus_action.sa_flags & SA_SIGINFO) != 0)
+    {
+        previous_bus_action.sa_sigaction(signal_number, info, context);
+    }
+    else if ((previous_bus_action.sa_handler != SIG_DFL) && (previous_bus_action.sa_handler != SIG_IGN))
+    {
+        previous_bus_action.sa_handler(signal_number);
+    }
+    else
+    {
+        // Restore the default action, the faulting access is repeated and raises the signal again
+        sigaction(SIGBUS, &previous_bus_action, nullptr);
+    }
+}
+
+/**
+ * Installs the handler that catches the faults of the guarded copies (see HandleMappingFault()).
+ * @return true if the handler was installed, false otherwise.
+ */
+static bool InstallMappingGuard() noexcept
+{
+    struct sigaction action = {};
+    action.sa_sigaction = HandleMappingFault;
+    sigemptyset(&action.sa_mask);
+
+    // The signal must not stay blocked after the jump out of the handler
+    action.sa_flags = SA_SIGINFO | SA_NODEFER;
+    return (sigaction(SIGBUS, &action, &previous_bus_action) == 0);
+}
+#endif
+
+/**
+ * Copies the specified number of bytes out of the mapping. Accessing a mapped page beyond the end of the file (after the
+ * file was truncated externally) raises SIGBUS, which aborts the copy instead of the process. No system call is issued
+ * per copy. Windows does not allow to truncate a mapped file, so the data is simply copied.
+ * @param target The buffer to copy into.
+ * @param source The mapped data.
+ * @param length The number of bytes to copy.
+ * @return true if the data was copied, false if the mapped pages are no longer backed by the file.
+ */
+bool TFile::CopyFromMapping(unsigned char* target, const unsigned char* source, std::size_t length) noexcept
+{
+    #if defined(_WIN32) || defined(__WIN32__)
+        memcpy(target, source, length);
+        return true;
+    #else
+        // Install the handler once (the signal mask is not saved by the jump buffer, which saves a system call per copy)
+        static const bool guard_installed = InstallMappingGuard();
+        if (!guard_installed) return false;
+
+        // Copy the data, a fault jumps back here
+        sigjmp_buf guard;
+        if (sigsetjmp(guard, 0) != 0)
+        {
+            mapping_guard = nullptr;
+            return false;
+        }
+        mapping_guard = &guard;
+        memcpy(target, source, length);
+        mapping_guard = nullptr;
+        return true;
+    #endif
+}
+
+/**
+ * Reads the specified number of bytes at the specified position out of the mapping into the specified buffer. If the
+ * file was truncated externally, the data is read from the file instead and the file is mapped again.
+ * @param buffer The buffer to read into.
+ * @param count The number of bytes to read.
+ * @param position The zero-based position to read at.
+ * @return The number of bytes that were read.
+ */
+uint32_t TFile::ReadFromMapping(unsigned char* buffer, uint32_t count, int64_t position) noexcept
+{
+    // Nothing can be read beyond the mapped range
+    if ((position < 0) || (position >= this->mapping_length_)) return 0;
+
+    // Limit the number of bytes to the mapped range
+    const auto bytes_to_read = static_cast<uint32_t>(hedit_min(static_cast<int64_t>(count), this->mapping_length_ - position));
+
+    // Copy the data
+    if (TFile::CopyFromMapping(buffer, &this->file_mapping_[position], bytes_to_read)) return bytes_to_read;
+
+    // The file was truncated, forget the size and the holes and map the (remaining) file again
+    this->file_size_ = -1;
+    this->hole_map_valid_ = false;
+    this->UnmapFile();
+    this->MapFile();
+    return this->ReadFromHandle(buffer, count, position);
+}
+
+/**
+ * Opens a second handle for direct I/O, if the (opened) file is a block device. Direct I/O bypasses the page cache of
+ * the system, so that scanning a whole device neither pollutes the system cache nor is slowed down by it. All reads and
+ * writes must be aligned to the logical sector size of the device, which is ensured by reading whole cache pages and
+ * writing whole sectors. Direct I/O is only supported under Linux.
+ * @param mode The file mode that was used for opening the file (see TFileMode).
+ * @return true if direct I/O is used, false otherwise.
+ */
+bool TFile::OpenDirect(TFileMode mode) noexcept
+{
+    #if defined(__linux__) && defined(O_DIRECT) && defined(BLKSSZGET)
+        // Only block devices use direct I/O
+        struct stat file_info = {};
+        if ((fstat(fileno(this->file_handle_), &file_info) != 0) || (!S_ISBLK(file_info.st_mode))) return false;
+
+        // Open the device a second time, bypassing the system cache
+        const auto handle = open(this->file_name_, ((mode == TFileMode::READ) ? O_RDONLY : O_RDWR) | O_DIRECT);
+        if (handle < 0) return false;
+
+        // Query the logical sector size (the cache pages must consist of whole, aligned sectors)
+        int sector_size = 0;
+        if ((ioctl(handle, BLKSSZGET, &sector_size) != 0) || (sector_size <= 0) ||
+            (static_cast<uint32_t>(sector_size) > HE_FILE_CACHE_ALIGNMENT) || ((HE_FILE_CACHE_PAGE_SIZE % static_cast<uint32_t>(sector_size)) != 0))
+        {
+            close(handle);
+            return false;
+        }
+
+        // Store the handle and the sector size
+        this->direct_handle_ = handle;
+        this->sector_size_ = static_cast<uint32_t>(sector_size);
+        return true;
+    #else
+        static_cast<void>(mode);
+        return false;
+    #endif
+}
+
+/**
+ * Closes the handle for direct I/O (if any).
+ */
+void TFile::CloseDirect() noexcept
+{
+    // Ensure the handle is open
+    if (this->direct_handle_ < 0) return;
+
+    #if !(defined(_WIN32) || defined(__WIN32__))
+        close(this->direct_handle_);
+    #endif
+
+    // Clear the handle
+    this->direct_handle_ = -1;
+    this->sector_size_ = 0;
+}
+
+/**
+ * Reads the specified number of bytes via direct I/O. The buffer, the length and the position must be aligned to the sector size.
+ * @param buffer The (aligned) buffer to read the data into.
+ * @param length The number of bytes to read.
+ * @param position The file offset to read at.
+ * @return The number of bytes read.
+ */
+uint32_t TFile::ReadDirect(unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    #if !(defined(_WIN32) || defined(__WIN32__))
+        const auto bytes_read = pread(this->direct_handle_, buffer, length, position);
+        return (bytes_read > 0) ? static_cast<uint32_t>(bytes_read) : 0;
+    #else
+        static_cast<void>(buffer);
+        static_cast<void>(length);
+        static_cast<void>(position);
+        return 0;
+    #endif
+}
+
+/**
+ * Writes the specified number of bytes via direct I/O. The sectors that are touched by the write are read into an aligned
+ * buffer, patched and written back as a whole (read-modify-write), so the data may have any position and length.
+ * @param buffer The buffer with the data.
+ * @param length The number of bytes to write.
+ * @param position The file offset to write at.
+ * @return The number of bytes written (either all or none).
+ */
+uint32_t TFile::WriteDirect(const unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    // Pages that are read ahead may become outdated, holes may be filled
+    if (this->read_ahead_) this->read_ahead_->Cancel();
+    this->hole_map_valid_ = false;
+
+    #if !(defined(_WIN32) || defined(__WIN32__))
+        // Calculate the range of the touched sectors
+        const auto sector_size = static_cast<int64_t>(this->sector_size_);
+        const auto start = position - (position % sector_size);
+        const auto end = ((position + length + sector_size - 1) / sector_size) * sector_size;
+        const auto size = static_cast<std::size_t>(end - start);
+
+        // Allocate an aligned buffer for the sectors
+        std::unique_ptr<unsigned char[]> memory;
+        try
+        {
+            memory.reset(new unsigned char[size + this->sector_size_]);
+        }
+        catch (const std::bad_alloc&)
+        {
+            return 0;
+        }
+        void* aligned_memory = memory.get();
+        std::size_t space = size + this->sector_size_;
+        auto sectors = static_cast<unsigned char*>(std::align(this->sector_size_, size, aligned_memory, space));
+
+        // Read the sectors, patch and write them back
+        if (pread(this->direct_handle_, sectors, size, start) != static_cast<ssize_t>(size)) return 0;
+        memcpy(&sectors[position - start], buffer, length);
+        if (pwrite(this->direct_handle_, sectors, size, start) != static_cast<ssize_t>(size)) return 0;
+
+        // Return the number of bytes written
+        return length;
+    #else
+        static_cast<void>(buffer);
+        static_cast<void>(length);
+        static_cast<void>(position);
+        return 0;
+    #endif
+}
+
+/**
+ * Returns true if the file position is tracked by the virtual file cursor (file_cursor_), which is the case
+ * if caching is used, if the file is mapped or if the overlay is enabled, false if the position of the stdio stream is used.
+ * @return true if the virtual file cursor is used, false otherwise.
+ */
+bool TFile::UsesVirtualCursor() const noexcept
+{
+    return ((this->use_cache_) || (this->file_mapping_ != nullptr) || (this->overlay_) || (this->gzip_));
+}
+
+/**
+ * Retrieves the hit and miss counters of the file cache.
+ * @param hits Receives the number of reads that were served by the cache.
+ * @param misses Receives the number of reads that required to load data from the file.
+ * @return true if caching is used, false otherwise (the counters are set to zero).
+ */
+bool TFile::GetCacheStatistics(uint64_t& hits, uint64_t& misses) const noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Check if caching is used
+    if (!this->file_cache_)
+    {
+        hits = 0;
+        misses = 0;
+        return false;
+    }
+
+    // Return the counters
+    std::lock_guard<std::recursive_mutex> cache_lock(this->file_cache_->GetLock());
+    hits = this->file_cache_->GetHits();
+    misses = this->file_cache_->GetMisses();
+    return true;
+}
+
+/**
+ * Returns the number of pages that were read ahead by the read-ahead engine (for sequential scans).
+ * @return The number of pages (0 if caching is not used).
+ */
+uint64_t TFile::GetReadAheadPages() const noexcept
+{
+    return (this->read_ahead_) ? this->read_ahead_->GetPagesRead() : 0;
+}
+
+/**
+ * Returns the version of the file content, which is changed by each write of any file object of the same file
+ * (if caching is used), so that views of the file can be refreshed after changes by other views.
+ * @return The version of the file content (always 0 if caching is not used).
+ */
+uint64_t TFile::GetVersion() const noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Check if caching is used
+    if (!this->file_cache_) return 0;
+
+    // Return the version
+    std::lock_guard<std::recursive_mutex> cache_lock(this->file_cache_->GetLock());
+    return this->file_cache_->GetVersion();
+}
+
+/**
+ * Collects the specified data, that is to be written at the specified position, in the write-back buffer.
+ * Adjacent and overlapping writes are merged into one block of pending data, other writes flush the pending data first.
+ * Only writes within the current file size are buffered (and only if the virtual file cursor is used), so that the
+ * pending data never changes the file size.
+ * @param buffer The buffer with the data.
+ * @param length The number of bytes to write.
+ * @param position The zero-based position to write at.
+ * @return true if the data was buffered, false if it must be written directly.
+ */
+bool TFile::WriteToBuffer(const unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    // Check if the write can be buffered at all
+    if ((!this->UsesVirtualCursor()) || (this->IsReadOnly()) || (length == 0) || (length > HE_FILE_WRITE_BUFFER_SIZE)) return false;
+
+    // Writes to a shared cache are written directly, so that the other file objects see the change at once
+    if ((this->file_cache_) && (this->file_cache_.use_count() > 1)) return false;
+
+    // Writes that extend the file are written directly
+    const auto end = position + length;
+    if (end > this->GetStoredSize()) return false;
+
+    // Write the pending data, if the new data cannot be merged
+    if (!this->dirty_data_.empty())
+    {
+        const auto dirty_end = this->dirty_start_ + static_cast<int64_t>(this->dirty_data_.size());
+        if ((position > dirty_end) || (end < this->dirty_start_) ||
+            ((hedit_max(end, dirty_end) - hedit_min(position, this->dirty_start_)) > HE_FILE_WRITE_BUFFER_SIZE))
+        {
+            if (!this->Flush()) return false;
+        }
+    }
+
+    // Reserve the whole buffer once, so that merging the data cannot fail
+    try
+    {
+        this->dirty_data_.reserve(HE_FILE_WRITE_BUFFER_SIZE);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+
+    // Start a new block of pending data
+    if (this->dirty_data_.empty()) this->dirty_start_ = position;
+
+    // Extend the pending data to the front and to the back, if required
+    if (position < this->dirty_start_)
+    {
+        this->dirty_data_.insert(this->dirty_data_.begin(), static_cast<std::size_t>(this->dirty_start_ - position), 0);
+        this->dirty_start_ = position;
+    }
+    if (end > (this->dirty_start_ + static_cast<int64_t>(this->dirty_data_.size()))) this->dirty_data_.resize(static_cast<std::size_t>(end - this->dirty_start_));
+
+    // Copy the new data
+    memcpy(&this->dirty_data_[static_cast<std::size_t>(position - this->dirty_start_)], buffer, length);
+
+    // Return success
+    return true;
+}
+
+/**
+ * Copies the pending data of the write-back buffer over the data read from the file, so that reads see the pending writes.
+ * @param buffer The buffer with the data read from the file.
+ * @param length The number of bytes in the buffer.
+ * @param position The file offset the data was read from.
+ */
+void TFile::ReadFromBuffer(unsigned char* buffer, uint32_t length, int64_t position) const noexcept
+{
+    // Check if there is pending data
+    if (this->dirty_data_.empty()) return;
+
+    // Calculate the overlapping range
+    const auto from = hedit_max(position, this->dirty_start_);
+    const auto to = hedit_min(position + length, this->dirty_start_ + static_cast<int64_t>(this->dirty_data_.size()));
+    if (from >= to) return;
+
+    // Copy the pending data
+    memcpy(&buffer[from - position], &this->dirty_data_[static_cast<std::size_t>(from - this->dirty_start_)], static_cast<std::size_t>(to - from));
+}
+
+/**
+ * Assigns a new file name to the file class, closing the current file if open.
+ * @param file_name The file name to assign to the file object.
+ */
+void TFile::AssignFileName(const char* file_name)
+{
+    std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+
+    // Close any open file
+    this->Close();
+
+    // Assign the new file name
+    this->file_name_ = file_name;
+}
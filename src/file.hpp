@@ -1,63 +1,198 @@
-// Copyright (c) 2021 Roxxorfreak
-
-#ifndef HEDIT_SRC_FILE_HPP_
-
-    // Header included
-    #define HEDIT_SRC_FILE_HPP_
-
-    // The size for the file cache
-    constexpr uint32_t HE_FILE_CACHE_SIZE = 8192;  //!< The size (in bytes) of the memory that is used for caching the file content.
-
-    // The file modes
-    enum class TFileMode : int32_t {
-        READ,       //!< The file is opened for reading only.
-        READWRITE,  //!< The file is opened for reading and writing.
-        CREATE      //!< The file opened for creation.
-    };
-
-    // File attributes
-    enum class TFileAttribute : int32_t {
-        NORMAL,         //!< The file was opened for reading and writing.
-        READ_ONLY,      //!< The file was opened read-only.
-        ACCESS_DENIED   //!< Access to the file was denied.
-    };
-
-    /**
-     * @brief The class that encapsulates a file object that can be used for platform-independent file access.
-     */
-    class TFile
-    {
-    private:
-        bool use_cache_;                 //!< The flag that specifies if caching is used.
-        unsigned char* file_buffer_;     //!< The buffer that is used to cache some file content, if caching is enabled.
-        int64_t cache_start_;            //!< The file offset where the cache starts.
-        int64_t cache_length_;           //!< The length of the cached block of data.
-        int64_t file_cursor_;            //!< The current position within the opened file, if caching is enabled.
-        FILE* file_handle_;              //!< The internal file handle.
-        TString file_name_;              //!< The name of the file that is handled by the file class.
-        TFileAttribute file_attribute_;  //!< The file attribute (see TFileAttribute).
-    private:
-        bool ReadIntoCache() noexcept;
-        uint32_t ReadFromCache(unsigned char* buffer, uint32_t count) noexcept;
-    public:
-        TFile(const char* file_name, bool use_cache);
-        TFile(const TFile& source) = delete;
-        TFile& operator=(const TFile& source) = delete;
-        TFile(TFile&&) = delete;
-        TFile& operator=(TFile&&) = delete;
-        ~TFile();
-        bool Open(TFileMode mode) noexcept;
-        void Close() noexcept;
-        uint32_t Read(unsigned char* buffer, uint32_t length) noexcept;
-        uint32_t ReadAt(unsigned char* buffer, uint32_t length, int64_t position) noexcept;
-        uint32_t Write(const unsigned char* buffer, uint32_t length) noexcept;
-        uint32_t WriteAt(const unsigned char* buffer, uint32_t length, int64_t position) noexcept;
-        bool Seek(int64_t position) noexcept;
-        TString ReadLine();
-        bool IsEOF() noexcept;
-        bool IsReadOnly() const noexcept;
-        int64_t FileSize() noexcept;
-        void AssignFileName(const char* file_name);
-    };
-
-#endif  // HEDIT_SRC_FILE_HPP_
+// Copyright (c) 2021 Roxxorfreak
+
+#ifndef HEDIT_SRC_FILE_HPP_
+
+    // Header included
+    #define HEDIT_SRC_FILE_HPP_
+
+    // The size for the write-back buffer
+    constexpr uint32_t HE_FILE_WRITE_BUFFER_SIZE = 65536;  //!< The maximum size (in bytes) of the pending data that is collected before it is written to the file.
+
+    // The size of the blocks that are copied while saving the changes of the overlay
+    constexpr uint32_t HE_FILE_SAVE_BLOCK_SIZE = 1048576;  //!< The size (in bytes) of the blocks that are moved within the file by Save().
+    constexpr uint32_t HE_FILE_KERNEL_COPY_SIZE = 1073741824;  //!< The maximum number of bytes that are copied by a single system call (see CopyTo()).
+
+    // The file modes
+    enum class TFileMode : int32_t {
+        READ,       //!< The file is opened for reading only.
+        READWRITE,  //!< The file is opened for reading and writing.
+        CREATE,     //!< The file opened for creation.
+        DECOMPRESS  //!< The decompressed content of a gzip file is opened for reading (other files are opened with READ).
+    };
+
+    // Foreward declaration (to avoid circular reference)
+    class TFileSnapshot;
+    class TFileSpool;
+    class TFileGzip;
+
+    // File attributes
+    enum class TFileAttribute : int32_t {
+        NORMAL,         //!< The file was opened for reading and writing.
+        READ_ONLY,      //!< The file was opened read-only.
+        ACCESS_DENIED   //!< Access to the file was denied.
+    };
+
+    /**
+     * @brief A hole of a sparse file (a range of the file that is not allocated and reads as zeros).
+     */
+    struct TFileHole
+    {
+        int64_t start;  //!< The file offset of the first byte of the hole.
+        int64_t end;    //!< The file offset behind the last byte of the hole.
+    };
+
+    /**
+     * @brief The interface that receives the progress of long-running file operations (see TFile::Save()).
+     */
+    class TFileProgress
+    {
+    public:
+        virtual ~TFileProgress() = default;
+        virtual void Progress(int64_t bytes_done, int64_t bytes_total) noexcept = 0;
+    };
+
+    /**
+     * @brief The class that encapsulates a file object that can be used for platform-independent file access.
+     */
+    class TFile
+    {
+    private:
+        bool use_cache_;                 //!< The flag that specifies if caching is used.
+        bool use_mapping_;               //!< The flag that specifies if the file is read via a memory mapping (if the file can be mapped).
+        unsigned char* file_mapping_;    //!< The read-only memory mapping of the file content, if the file is mapped.
+        int64_t mapping_length_;         //!< The length of the mapped file content (in bytes).
+        #if defined(_WIN32) || defined(__WIN32__)
+        HANDLE mapping_handle_;          //!< The handle of the file mapping object (Windows only).
+        #endif
+        std::shared_ptr<TFileCache> file_cache_;  //!< The page cache for the file content, if caching is enabled (shared by all file objects of the same file).
+        uint32_t cache_size_;            //!< The size (in bytes) of the memory that is used for caching.
+        uint64_t cache_version_;         //!< The version of the cache content that is known to the file object (see TFileCache::GetVersion()).
+        std::unique_ptr<TFileReadAhead> read_ahead_;  //!< The engine that reads the pages ahead of sequential scans, if caching is enabled.
+        int direct_handle_;              //!< The handle for direct (unbuffered, sector-aligned) I/O on block devices, -1 if not used.
+        uint32_t sector_size_;           //!< The logical sector size of the block device, if direct I/O is used.
+        std::vector<unsigned char> dirty_data_;   //!< The pending data of the write-back buffer (not yet written to the file).
+        int64_t dirty_start_;            //!< The file offset of the pending data.
+        std::vector<unsigned char> peek_buffer_;  //!< The buffer for views (see Peek()) that cannot refer to the cache or the mapping directly.
+        int64_t pinned_page_;            //!< The cache page that is pinned by the last view (-1 if none, see TFileCache::Pin()).
+        std::vector<TFileHole> hole_map_;         //!< The holes of the file (sorted by offset), if the file is sparse.
+        std::unique_ptr<TPieceTable> overlay_;    //!< The overlay that collects all changes in memory until they are saved, if enabled (see EnableOverlay()).
+        std::unique_ptr<TFileSnapshot> snapshot_;  //!< The snapshot of the file, once it is taken (see EnableSnapshot()).
+        TString snapshot_name_;          //!< The name of the snapshot that is taken before the first change (empty if no snapshot is taken).
+        std::unique_ptr<TFileSpool> spool_;  //!< The spool that copies the stream into the temporary file, if the file is a stream (see OpenSpool()).
+        std::unique_ptr<TFileGzip> gzip_;    //!< The decompressor that reads the content of a gzip file, if it is opened decompressed (see OpenGzip()).
+        TFileProgress* progress_;        //!< The receiver of the progress of the running save operation (nullptr if none).
+        int64_t progress_done_;          //!< The number of bytes processed by the running save operation.
+        int64_t progress_total_;         //!< The number of bytes to process by the running save operation.
+        bool hole_map_valid_;            //!< The flag that specifies if the hole map is up to date (it is rebuilt after writes).
+        int64_t file_cursor_;            //!< The current position within the opened file, if caching is enabled.
+        int64_t file_size_;              //!< The cached size of the opened file (-1 if the size is to be queried).
+        FILE* file_handle_;              //!< The internal file handle.
+        TString file_name_;              //!< The name of the file that is handled by the file class.
+        TFileAttribute file_attribute_;  //!< The file attribute (see TFileAttribute).
+        mutable std::recursive_mutex mutex_;  //!< The lock that synchronizes the access to the file, the cache and the write-back buffer.
+        int32_t unlocked_reads_;         //!< The number of reads via PRead() that run without the lock (the handle is not closed until they are completed).
+        std::mutex unlocked_read_mutex_;  //!< The lock for the number of reads that run without the lock.
+        std::condition_variable unlocked_read_signal_;  //!< The signal for the completion of a read that runs without the lock.
+    private:
+        void AttachHandle(TFileMode mode) noexcept;
+        bool OpenSpool(TFileMode mode) noexcept;
+        bool OpenGzip() noexcept;
+        void AttachCache(TFileMode mode) noexcept;
+        void DetachCache() noexcept;
+        void CheckCacheVersion() noexcept;
+        void UpdateCache(int64_t position, const unsigned char* buffer, uint32_t length) noexcept;
+        bool QueryFileId(uint64_t& device, uint64_t& inode) const noexcept;
+        static bool IsFileShared(const char* file_name) noexcept;
+        TFileCachePage* LoadCachePage(int64_t page_start) noexcept;
+        void CollectReadAhead(int64_t page_start) noexcept;
+        void ScheduleReadAhead(int64_t page_start) noexcept;
+        uint32_t ReadFromCache(unsigned char* buffer, uint32_t count, int64_t position) noexcept;
+        bool MapFile() noexcept;
+        void UnmapFile() noexcept;
+        bool CheckMapping() noexcept;
+        bool CanReadUnlocked(uint32_t length, int64_t position) noexcept;
+        void WaitForUnlockedReads() noexcept;
+        uint32_t ReadFromMapping(unsigned char* buffer, uint32_t count, int64_t position) noexcept;
+        static bool CopyFromMapping(unsigned char* target, const unsigned char* source, std::size_t length) noexcept;
+        bool UsesVirtualCursor() const noexcept;
+        int64_t QueryFileSize() noexcept;
+        void BuildHoleMap() noexcept;
+        bool OpenDirect(TFileMode mode) noexcept;
+        void CloseDirect() noexcept;
+        uint32_t ReadDirect(unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+        uint32_t WriteDirect(const unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+        bool WriteToBuffer(const unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+        void ReadFromBuffer(unsigned char* buffer, uint32_t length, int64_t position) const noexcept;
+        uint32_t ReadData(unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+        uint32_t WriteData(const unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+        bool IsOverlayed() const noexcept;
+        bool PrepareOverlay() noexcept;
+        uint32_t ReadFromOverlay(unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+        uint32_t ReadStoredData(unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+        uint32_t WriteStoredData(const unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+        bool WriteStoredRange(const unsigned char* buffer, int64_t buffer_length, int64_t length, int64_t position) noexcept;
+        bool ClearStoredRange(int64_t position, int64_t length, const std::vector<unsigned char>& zeros) noexcept;
+        bool PunchStoredRange(int64_t position, int64_t length) noexcept;
+        bool MoveStoredData(int64_t source, int64_t target, int64_t length, std::vector<unsigned char>& block) noexcept;
+        bool TruncateStoredData(int64_t size) noexcept;
+        void ShiftStoredData(std::vector<TPiece>& pieces) noexcept;
+        void ReportProgress(int64_t length) noexcept;
+        void StartSnapshot() noexcept;
+        bool CompleteSnapshot(TFileProgress* progress) noexcept;
+        int64_t CopyStoredData(TFile* target, int64_t position, int64_t length, int64_t target_position) noexcept;
+        int64_t CopyBuffered(TFile* target, int64_t position, int64_t length, int64_t target_position) noexcept;
+        void ResetStoredState() noexcept;
+        int64_t GetStoredSize() noexcept;
+        static void ReplicatePattern(unsigned char* buffer, std::size_t length, const unsigned char* pattern, std::size_t pattern_length) noexcept;
+        bool GetStoredExtent(int64_t position, int64_t& extent_start, int64_t& extent_end) noexcept;
+        uint32_t ReadFromHandle(unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+        uint32_t WriteToHandle(const unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+    public:
+        TFile(const char* file_name, bool use_cache, bool use_mapping = false, uint32_t cache_size = HE_FILE_CACHE_DEFAULT_SIZE);
+        TFile(const TFile& source) = delete;
+        TFile& operator=(const TFile& source) = delete;
+        TFile(TFile&&) = delete;
+        TFile& operator=(TFile&&) = delete;
+        ~TFile();
+        bool Open(TFileMode mode) noexcept;
+        void Close() noexcept;
+        uint32_t Read(unsigned char* buffer, uint32_t length) noexcept;
+        uint32_t ReadAt(unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+        const unsigned char* Peek(int64_t position, uint32_t length, uint32_t& available) noexcept;
+        uint32_t Write(const unsigned char* buffer, uint32_t length) noexcept;
+        uint32_t WriteAt(const unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+        uint32_t PRead(unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+        uint32_t PWrite(const unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+        int64_t CopyTo(TFile* target, int64_t position, int64_t length, int64_t target_position) noexcept;
+        bool Seek(int64_t position) noexcept;
+        bool Flush() noexcept;
+        bool IsDirty() const noexcept;
+        bool EnableOverlay() noexcept;
+        bool DisableOverlay() noexcept;
+        bool EnableSnapshot(const char* snapshot_name) noexcept;
+        bool IsSnapshotPending() noexcept;
+        bool Insert(int64_t position, const unsigned char* buffer, int64_t length) noexcept;
+        bool Erase(int64_t position, int64_t length) noexcept;
+        bool Fill(int64_t position, const unsigned char* pattern, uint32_t pattern_length, int64_t length, TFileProgress* progress = nullptr) noexcept;
+        bool Save(TFileProgress* progress = nullptr) noexcept;
+        bool SaveAs(const char* file_name, TFileProgress* progress = nullptr) noexcept;
+        bool IsModified() const noexcept;
+        TString ReadLine();
+        bool IsEOF() noexcept;
+        bool IsReadOnly() const noexcept;
+        bool IsMapped() const noexcept;
+        bool IsDirect() const noexcept;
+        bool IsStreaming() noexcept;
+        bool IsCompressed() const noexcept;
+        int64_t WaitForSize(int64_t size, int32_t timeout) noexcept;
+        int64_t FileSize() noexcept;
+        int64_t RefreshFileSize() noexcept;
+        bool GetExtent(int64_t position, int64_t& extent_start, int64_t& extent_end) noexcept;
+        std::vector<TFileHole> GetHoleMap();
+        bool GetCacheStatistics(uint64_t& hits, uint64_t& misses) const noexcept;
+        uint64_t GetReadAheadPages() const noexcept;
+        uint64_t GetVersion() const noexcept;
+        void AssignFileName(const char* file_name);
+    };
+
+#endif  // HEDIT_SRC_FILE_HPP_
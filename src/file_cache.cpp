@@ -0,0 +1,396 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers.hpp"
+
+/**
+ * Creates a new file cache with as many pages as fit into the specified cache size (at least one page).
+ * The memory for the pages is allocated when a page is used for the first time.
+ * @param cache_size The size (in bytes) of the memory that is used for caching.
+ */
+TFileCache::TFileCache(uint32_t cache_size)
+{
+    // Calculate the number of pages
+    const auto page_count = hedit_max(cache_size / HE_FILE_CACHE_PAGE_SIZE, 1U);
+
+    // Create the (unused) pages
+    this->pages_.resize(page_count);
+}
+
+/**
+ * Searches the cache for the page that holds the block starting at the specified file offset.
+ * Each lookup is counted as either hit or miss.
+ * @param page_start The file offset of the block (must be a multiple of HE_FILE_CACHE_PAGE_SIZE).
+ * @return The cached page or nullptr if the block is not cached.
+ */
+TFileCachePage* TFileCache::Find(int64_t page_start) noexcept
+{
+    // Search the index
+    const auto entry = this->index_.find(page_start);
+    if (entry == this->index_.end())
+    {
+        this->misses_++;
+        return nullptr;
+    }
+
+    // Mark the page as recently used
+    auto page = &this->pages_[entry->second];
+    page->last_access = ++this->access_counter_;
+    this->hits_++;
+
+    // Return the page
+    return page;
+}
+
+/**
+ * Assigns a page to the block starting at the specified file offset, recycling the least recently used page if required.
+ * The returned page is empty (length 0) and must be filled by the caller.
+ * @param page_start The file offset of the block (must be a multiple of HE_FILE_CACHE_PAGE_SIZE).
+ * @return The page for the block.
+ */
+TFileCachePage* TFileCache::Allocate(int64_t page_start)
+{
+    // Get a page for the block
+    auto page = this->Assign(page_start);
+
+    // Allocate the page memory on first use (with room for the alignment)
+    if (!page->memory)
+    {
+        page->memory.reset(new unsigned char[HE_FILE_CACHE_PAGE_SIZE + HE_FILE_CACHE_ALIGNMENT]);
+        void* aligned_memory = page->memory.get();
+        std::size_t space = HE_FILE_CACHE_PAGE_SIZE + HE_FILE_CACHE_ALIGNMENT;
+        page->data = static_cast<unsigned char*>(std::align(HE_FILE_CACHE_ALIGNMENT, HE_FILE_CACHE_PAGE_SIZE, aligned_memory, space));
+    }
+
+    // Return the page
+    return page;
+}
+
+/**
+ * Moves a block that was read outside of the cache (e.g. by the read-ahead engine) into the cache, swapping the memory
+ * of the block with the memory of the (recycled) page, so that no data is copied. If the block is already cached, the
+ * cached data is kept (it may be newer) and the block is not changed.
+ * @param block The block to move into the cache, receives the memory of the recycled page (which may be empty).
+ * @return The page that holds the block.
+ */
+TFileCachePage* TFileCache::Adopt(TFileCachePage& block)
+{
+    // Keep the cached data, if any
+    const auto entry = this->index_.find(block.start);
+    if (entry != this->index_.end()) return &this->pages_[entry->second];
+
+    // Get a page for the block and exchange the memory
+    auto page = this->Assign(block.start);
+    std::swap(page->memory, block.memory);
+    std::swap(page->data, block.data);
+    page->length = block.length;
+
+    // Return the page
+    return page;
+}
+
+/**
+ * Checks if the block starting at the specified file offset is cached, without counting a hit or miss.
+ * @param page_start The file offset of the block.
+ * @return true if the block is cached, false otherwise.
+ */
+bool TFileCache::Contains(int64_t page_start) const noexcept
+{
+    return (this->index_.find(page_start) != this->index_.end());
+}
+
+/**
+ * Assigns an unused or the least recently used page (that is not pinned) to the block starting at the specified file offset.
+ * The page is empty (length 0), its memory is not allocated.
+ * @param page_start The file offset of the block.
+ * @return The page for the block.
+ */
+TFileCachePage* TFileCache::Assign(int64_t page_start)
+{
+    // Drop the block, if already cached
+    this->Discard(page_start);
+
+    // Find an unused or the least recently used page (that is not pinned)
+    auto slot = this->pages_.size();
+    for (std::size_t index = 0; index < this->pages_.size(); index++)
+    {
+        if (this->pages_[index].pins > 0) continue;
+        if (this->pages_[index].start < 0)
+        {
+            slot = index;
+            break;
+        }
+        if ((slot == this->pages_.size()) || (this->pages_[index].last_access < this->pages_[slot].last_access)) slot = index;
+    }
+
+    // Add a page, if all pages are pinned
+    if (slot == this->pages_.size()) this->pages_.emplace_back();
+    auto page = &this->pages_[slot];
+
+    // Remove the recycled block from the index
+    if (page->start >= 0) this->index_.erase(page->start);
+
+    // Assign the page to the block
+    page->start = page_start;
+    page->length = 0;
+    page->last_access = ++this->access_counter_;
+    this->index_[page_start] = slot;
+
+    // Return the page
+    return page;
+}
+
+/**
+ * Removes the block starting at the specified file offset from the cache (if cached).
+ * @param page_start The file offset of the block.
+ */
+void TFileCache::Discard(int64_t page_start) noexcept
+{
+    // Search the index
+    const auto entry = this->index_.find(page_start);
+    if (entry == this->index_.end()) return;
+
+    // Release the page
+    const auto index = entry->second;
+    this->index_.erase(entry);
+    this->Release(index);
+}
+
+/**
+ * Releases the page with the specified index, after its block was removed from the index. The memory is kept for reuse,
+ * a pinned page keeps its data until it is unpinned (see Unpin()).
+ * @param index The index of the page.
+ */
+void TFileCache::Release(std::size_t index) noexcept
+{
+    auto& page = this->pages_[index];
+    page.start = -1;
+    if (page.pins > 0)
+        page.stale = true;
+    else
+        page.length = 0;
+}
+
+/**
+ * Pins the page of the block starting at the specified file offset, so that the page is not recycled (and its data is
+ * not changed) while its data is referenced. Each call must be followed by a call of Unpin() with the returned page.
+ * @param page_start The file offset of the block.
+ * @return The index of the pinned page, -1 if the block is not cached.
+ */
+int64_t TFileCache::Pin(int64_t page_start) noexcept
+{
+    // Search the index
+    const auto entry = this->index_.find(page_start);
+    if (entry == this->index_.end()) return -1;
+
+    // Increase the pin count
+    this->pages_[entry->second].pins++;
+    return static_cast<int64_t>(entry->second);
+}
+
+/**
+ * Releases a pin of the specified page. The last pin of a page whose block was dropped in the meantime releases the page.
+ * @param page The index of the page (see Pin()).
+ */
+void TFileCache::Unpin(int64_t page) noexcept
+{
+    // Ensure a valid page
+    if ((page < 0) || (page >= static_cast<int64_t>(this->pages_.size()))) return;
+    auto& pinned_page = this->pages_[static_cast<std::size_t>(page)];
+
+    // Decrease the pin count, releasing a dropped page with the last pin
+    if (pinned_page.pins > 0) pinned_page.pins--;
+    if ((pinned_page.pins == 0) && (pinned_page.stale))
+    {
+        pinned_page.stale = false;
+        pinned_page.length = 0;
+    }
+}
+
+/**
+ * Copies data that was written to the file into all cached pages that cover the written range, so that
+ * the cache does not have to be reloaded. Pages that cannot be patched consistently (writes that leave
+ * a gap behind the cached data of a page) and pinned pages (their data is still referenced) are discarded.
+ * @param position The file offset the data was written to.
+ * @param buffer The data that was written.
+ * @param length The number of bytes that were written.
+ */
+void TFileCache::Update(int64_t position, const unsigned char* buffer, uint32_t length) noexcept
+{
+    // A write behind a short (last) page extends the file, so the short page becomes outdated
+    const auto end = position + length;
+    const auto first_page = position - (position % HE_FILE_CACHE_PAGE_SIZE);
+    for (auto entry = this->index_.begin(); (entry != this->index_.end()) && (entry->first < first_page);)
+    {
+        if (this->pages_[entry->second].length >= HE_FILE_CACHE_PAGE_SIZE)
+        {
+            ++entry;
+            continue;
+        }
+        this->Release(entry->second);
+        entry = this->index_.erase(entry);
+    }
+
+    // Process all blocks that are touched by the write
+    for (auto page_start = first_page; page_start < end; page_start += HE_FILE_CACHE_PAGE_SIZE)
+    {
+        // Skip blocks that are not cached
+        const auto entry = this->index_.find(page_start);
+        if (entry == this->index_.end()) continue;
+        auto page = &this->pages_[entry->second];
+
+        // Calculate the written range within the page
+        const auto from = static_cast<uint32_t>(hedit_max(position, page_start) - page_start);
+        const auto to = static_cast<uint32_t>(hedit_min(end, page_start + HE_FILE_CACHE_PAGE_SIZE) - page_start);
+
+        // A write behind the cached data would leave a gap and the data of a pinned page is still referenced, drop the page
+        if ((from > page->length) || (page->pins > 0))
+        {
+            this->Discard(page_start);
+            continue;
+        }
+
+        // Patch the page (extending it, if the file grew)
+        memcpy(&page->data[from], &buffer[page_start + from - position], to - from);
+        page->length = hedit_max(page->length, to);
+    }
+
+    // The content has changed
+    this->version_++;
+}
+
+/**
+ * Removes all blocks from the cache.
+ */
+void TFileCache::Invalidate() noexcept
+{
+    // Release all cached pages (the memory is kept for reuse, pinned pages keep their data until they are unpinned)
+    for (const auto& entry : this->index_) this->Release(entry.second);
+
+    // Clear the index
+    this->index_.clear();
+
+    // The content has changed
+    this->version_++;
+}
+
+/**
+ * Returns the number of pages of the cache.
+ * @return The number of pages of the cache.
+ */
+uint32_t TFileCache::GetPageCount() const noexcept
+{
+    return static_cast<uint32_t>(this->pages_.size());
+}
+
+/**
+ * Returns the number of lookups that were served by the cache.
+ * @return The number of cache hits.
+ */
+uint64_t TFileCache::GetHits() const noexcept
+{
+    return this->hits_;
+}
+
+/**
+ * Returns the number of lookups that were not served by the cache.
+ * @return The number of cache misses.
+ */
+uint64_t TFileCache::GetMisses() const noexcept
+{
+    return this->misses_;
+}
+
+/**
+ * Resets the hit and miss counters.
+ */
+void TFileCache::ResetStatistics() noexcept
+{
+    this->hits_ = 0;
+    this->misses_ = 0;
+}
+
+/**
+ * Returns the version of the cached content. The version is increased by each change of the content, so file objects that
+ * share the cache can detect changes that were made by other file objects.
+ * @return The version of the cached content.
+ */
+uint64_t TFileCache::GetVersion() const noexcept
+{
+    return this->version_;
+}
+
+/**
+ * Returns the lock that must be held while the cache is accessed.
+ * @return The lock of the cache.
+ */
+std::recursive_mutex& TFileCache::GetLock() noexcept
+{
+    return this->mutex_;
+}
+
+// The registered caches
+std::mutex TFileCacheRegistry::mutex_;
+std::map<std::pair<uint64_t, uint64_t>, std::weak_ptr<TFileCache>> TFileCacheRegistry::caches_;
+
+/**
+ * Returns the cache for the specified file. If no file object uses a cache for the file yet, a new cache is created.
+ * @param device The device that holds the file.
+ * @param inode The inode (file index) of the file.
+ * @param cache_size The size (in bytes) of the memory that is used for caching, if a new cache is created.
+ * @return The cache of the file.
+ */
+std::shared_ptr<TFileCache> TFileCacheRegistry::Acquire(uint64_t device, uint64_t inode, uint32_t cache_size)
+{
+    std::lock_guard<std::mutex> lock(TFileCacheRegistry::mutex_);
+
+    // Drop the entries of the released caches
+    for (auto entry = TFileCacheRegistry::caches_.begin(); entry != TFileCacheRegistry::caches_.end();)
+    {
+        if (entry->second.expired())
+            entry = TFileCacheRegistry::caches_.erase(entry);
+        else
+            ++entry;
+    }
+
+    // Return the cache of the file, create a new cache if there is none
+    auto& entry = TFileCacheRegistry::caches_[std::make_pair(device, inode)];
+    auto cache = entry.lock();
+    if (!cache)
+    {
+        cache = std::make_shared<TFileCache>(cache_size);
+        entry = cache;
+    }
+    return cache;
+}
+
+/**
+ * Checks if a cache is in use for the specified file (i.e. the file is open in a file object that uses caching).
+ * @param device The device that holds the file (the device number for block devices).
+ * @param inode The inode of the file (0 for block devices).
+ * @return true if a cache is in use for the file, false otherwise.
+ */
+bool TFileCacheRegistry::IsRegistered(uint64_t device, uint64_t inode)
+{
+    std::lock_guard<std::mutex> lock(TFileCacheRegistry::mutex_);
+
+    // Find the cache of the file
+    const auto entry = TFileCacheRegistry::caches_.find(std::make_pair(device, inode));
+    return ((entry != TFileCacheRegistry::caches_.end()) && (!entry->second.expired()));
+}
+
+/**
+ * Returns the number of caches that are in use.
+ * @return The number of caches.
+ */
+std::size_t TFileCacheRegistry::GetCacheCount()
+{
+    std::lock_guard<std::mutex> lock(TFileCacheRegistry::mutex_);
+
+    // Count the caches that are still used
+    std::size_t count = 0;
+    for (const auto& entry : TFileCacheRegistry::caches_)
+    {
+        if (!entry.second.expired()) count++;
+    }
+    return count;
+}
@@ -0,0 +1,86 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#ifndef HEDIT_SRC_FILE_CACHE_HPP_
+
+    // Header included
+    #define HEDIT_SRC_FILE_CACHE_HPP_
+
+    // The sizes for the file cache
+    constexpr uint32_t HE_FILE_CACHE_PAGE_SIZE = 65536;         //!< The size (in bytes) of a single cache page. Each page caches an aligned block of the file.
+    constexpr uint32_t HE_FILE_CACHE_DEFAULT_SIZE = 1048576;    //!< The default size (in bytes) of the memory that is used for caching the file content.
+    constexpr uint32_t HE_FILE_CACHE_ALIGNMENT = 4096;          //!< The alignment (in bytes) of the page memory, sufficient for direct I/O on block devices.
+
+    /**
+     * @brief The structure for a single page of the file cache.
+     */
+    struct TFileCachePage
+    {
+        int64_t start = -1;                             //!< The file offset where the cached block starts (-1 if the page is unused).
+        uint32_t length = 0;                            //!< The number of valid bytes in the page (less than the page size at the end of the file).
+        uint64_t last_access = 0;                       //!< The access stamp of the last access, used to find the least recently used page.
+        uint32_t pins = 0;                              //!< The number of views that refer to the page data (pinned pages are not recycled).
+        bool stale = false;                             //!< The flag that specifies if the block was dropped while the page was pinned (the page is released by the last Unpin()).
+        std::unique_ptr<unsigned char[]> memory = {};   //!< The memory of the page (allocated on first use).
+        unsigned char* data = nullptr;                  //!< The cached data (within the page memory, aligned to HE_FILE_CACHE_ALIGNMENT).
+    };
+
+    /**
+     * @brief The page cache that is used by the file class to cache blocks of the file content.
+     * @details The cache holds a fixed number of pages. If all pages are in use, the least recently used page is recycled.
+     * Pages can be pinned while their data is referenced from outside, pinned pages are never recycled: a pinned page whose
+     * block is dropped (see Discard(), Update() and Invalidate()) is removed from the index, but keeps its data until it is unpinned.
+     * A cache may be shared by multiple file objects (see TFileCacheRegistry), so all accesses must hold the lock of the cache.
+     */
+    class TFileCache
+    {
+    private:
+        uint64_t access_counter_ = {};          //!< The counter used to create the access stamps.
+        uint64_t hits_ = {};                    //!< The number of lookups that were served by the cache.
+        uint64_t misses_ = {};                  //!< The number of lookups that were not served by the cache.
+        uint64_t version_ = {};                 //!< The version of the cached content, increased by each change (see Update() and Invalidate()).
+        std::recursive_mutex mutex_;            //!< The lock for the cache (the cache may be shared by multiple file objects).
+        std::vector<TFileCachePage> pages_;     //!< The cache pages.
+        std::map<int64_t, std::size_t> index_;  //!< The index of the cached blocks (file offset of the block => page index).
+    private:
+        TFileCachePage* Assign(int64_t page_start);
+        void Release(std::size_t index) noexcept;
+    public:
+        explicit TFileCache(uint32_t cache_size);
+        TFileCache(const TFileCache& source) = delete;
+        TFileCache& operator=(const TFileCache& source) = delete;
+        TFileCache(TFileCache&&) = delete;
+        TFileCache& operator=(TFileCache&&) = delete;
+        TFileCachePage* Find(int64_t page_start) noexcept;
+        TFileCachePage* Allocate(int64_t page_start);
+        TFileCachePage* Adopt(TFileCachePage& block);
+        bool Contains(int64_t page_start) const noexcept;
+        void Discard(int64_t page_start) noexcept;
+        int64_t Pin(int64_t page_start) noexcept;
+        void Unpin(int64_t page) noexcept;
+        void Update(int64_t position, const unsigned char* buffer, uint32_t length) noexcept;
+        void Invalidate() noexcept;
+        uint32_t GetPageCount() const noexcept;
+        uint64_t GetHits() const noexcept;
+        uint64_t GetMisses() const noexcept;
+        void ResetStatistics() noexcept;
+        uint64_t GetVersion() const noexcept;
+        std::recursive_mutex& GetLock() noexcept;
+    };
+
+    /**
+     * @brief The process-wide registry of the file caches, so that all file objects that access the same file (or device)
+     * share a single cache. The caches are identified by the device and the inode (the file index under Windows) of the file.
+     * A cache is released when the last file object that uses the cache is closed.
+     */
+    class TFileCacheRegistry
+    {
+    private:
+        static std::mutex mutex_;                                                           //!< The lock for the registry.
+        static std::map<std::pair<uint64_t, uint64_t>, std::weak_ptr<TFileCache>> caches_;  //!< The registered caches (device and inode => cache).
+    public:
+        static std::shared_ptr<TFileCache> Acquire(uint64_t device, uint64_t inode, uint32_t cache_size);
+        static bool IsRegistered(uint64_t device, uint64_t inode);
+        static std::size_t GetCacheCount();
+    };
+
+#endif  // HEDIT_SRC_FILE_CACHE_HPP_
@@ -0,0 +1,534 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers.hpp"
+
+/**
+ * Creates the access to a gzip file, the index is loaded or built by Open().
+ * @param file_name The name of the gzip file (the name of the cached index is derived from it).
+ */
+TFileGzip::TFileGzip(const char* file_name)
+    : index_name_(file_name)
+{
+    this->index_name_ += HE_FILE_GZIP_INDEX_SUFFIX;
+}
+
+/**
+ * Destructor, stops the worker thread and releases the decompressor.
+ */
+TFileGzip::~TFileGzip()
+{
+    // Tell the worker to terminate
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->stop_ = true;
+    }
+
+    // Wait for the worker
+    if (this->worker_.joinable()) this->worker_.join();
+
+    // Release the decompressor of the last read
+    this->EndStream();
+}
+
+/**
+ * Loads the cached index of the gzip file or starts building the index in the background.
+ * @param handle The handle of the gzip file, which must stay open until the object is destroyed.
+ * @return true on success, false otherwise.
+ */
+bool TFileGzip::Open(int handle) noexcept
+{
+    #if defined(HE_HAS_ZLIB)
+        // Get the identity of the file (the cached index must match it)
+        struct stat file_info = {};
+        if (fstat(handle, &file_info) != 0) return false;
+        this->handle_ = handle;
+        this->compressed_size_ = static_cast<int64_t>(file_info.st_size);
+        this->modification_time_ = static_cast<int64_t>(file_info.st_mtime);
+
+        // Allocate the buffers of the reads
+        try
+        {
+            this->input_.resize(HE_FILE_GZIP_CHUNK_SIZE);
+            this->discard_.resize(HE_FILE_GZIP_CHUNK_SIZE);
+        }
+        catch (const std::bad_alloc&)
+        {
+            return false;
+        }
+
+        // Use the cached index, if it is up to date
+        if (this->LoadIndex()) return true;
+
+        // Build the index in the background
+        try
+        {
+            this->worker_ = std::thread(&TFileGzip::Run, this);
+        }
+        catch (const std::exception&)
+        {
+            this->done_ = true;
+            return false;
+        }
+        return true;
+    #else
+        static_cast<void>(handle);
+        return false;
+    #endif
+}
+
+/**
+ * Reads the specified number of decompressed bytes at the specified position. The decompression starts at the
+ * checkpoint in front of the position, unless the decompression of the last read can be continued.
+ * @param buffer The buffer to read the data into.
+ * @param length The number of bytes to read.
+ * @param position The zero-based position within the decompressed data.
+ * @return The number of bytes read (only indexed data can be read, see WaitFor()).
+ */
+uint32_t TFileGzip::Read(unsigned char* buffer, uint32_t length, int64_t position) noexcept
+{
+    #if defined(HE_HAS_ZLIB)
+        // Find the checkpoint in front of the position (the checkpoints are not moved while the index grows)
+        const TGzipCheckpoint* checkpoint = nullptr;
+        uint32_t count = 0;
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            if ((position < 0) || (position >= this->length_) || (this->checkpoints_.empty())) return 0;
+            count = static_cast<uint32_t>(hedit_min(static_cast<int64_t>(length), this->length_ - position));
+            const auto next = std::upper_bound(this->checkpoints_.begin(), this->checkpoints_.end(), position,
+                [](int64_t value, const TGzipCheckpoint& element) { return (value < element.out); });
+            if (next == this->checkpoints_.begin()) return 0;
+            checkpoint = &(*(next - 1));
+        }
+
+        // Continue the last decompression, if it has not passed the position and is not behind the checkpoint
+        if ((!this->stream_active_) || (this->stream_out_ > position) || (this->stream_out_ < checkpoint->out))
+        {
+            this->EndStream();
+            if (!this->StartStream(*checkpoint)) return 0;
+        }
+
+        // Skip the data in front of the position
+        while (this->stream_out_ < position)
+        {
+            const auto skip = static_cast<uint32_t>(hedit_min(position - this->stream_out_, static_cast<int64_t>(this->discard_.size())));
+            if (this->Inflate(this->discard_.data(), skip) == 0)
+            {
+                this->EndStream();
+                return 0;
+            }
+        }
+
+        // Decompress the data
+        uint32_t bytes_read = 0;
+        while (bytes_read < count)
+        {
+            const auto result = this->Inflate(&buffer[bytes_read], count - bytes_read);
+            if (result == 0)
+            {
+                this->EndStream();
+                break;
+            }
+            bytes_read += result;
+        }
+        return bytes_read;
+    #else
+        static_cast<void>(buffer);
+        static_cast<void>(length);
+        static_cast<void>(position);
+        return 0;
+    #endif
+}
+
+/**
+ * Waits until the data up to the specified end is indexed or the index is complete.
+ * @param end The end of the range that is needed.
+ * @param timeout The maximum time to wait (in ms), -1 to wait until the data is indexed.
+ * @return The number of bytes that are indexed.
+ */
+int64_t TFileGzip::WaitFor(int64_t end, int32_t timeout) noexcept
+{
+    std::unique_lock<std::mutex> lock(this->mutex_);
+
+    // Wait for the index
+    const auto is_indexed = [this, end]() { return ((this->done_) || (this->length_ >= end)); };
+    if (timeout < 0)
+        this->signal_.wait(lock, is_indexed);
+    else
+        this->signal_.wait_for(lock, std::chrono::milliseconds(timeout), is_indexed);
+    return this->length_;
+}
+
+/**
+ * Returns the number of decompressed bytes that are indexed so far.
+ * @return The number of bytes that are indexed.
+ */
+int64_t TFileGzip::Length() noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    return this->length_;
+}
+
+/**
+ * Returns true if the index is complete (or failed), false if it is being built.
+ * @return true if the index is complete, false otherwise.
+ */
+bool TFileGzip::IsDone() noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    return this->done_;
+}
+
+/**
+ * Returns true if the whole file was indexed successfully, false if the index is being built or if the file is damaged
+ * (the data in front of the damage can be read).
+ * @return true if the file was indexed successfully, false otherwise.
+ */
+bool TFileGzip::IsSuccessful() noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    return ((this->done_) && (this->success_));
+}
+
+/**
+ * Returns true if the specified file is a regular file that starts with the gzip signature (and zlib is available).
+ * @param file_name The name of the file.
+ * @return true if the file is compressed, false otherwise.
+ */
+bool TFileGzip::IsCompressed(const char* file_name) noexcept
+{
+    #if defined(HE_HAS_ZLIB)
+        // Only regular files can be read at arbitrary positions
+        struct stat file_info = {};
+        if ((stat(file_name, &file_info) != 0) || (!S_ISREG(file_info.st_mode))) return false;
+
+        // Check the signature
+        unsigned char signature[2] = {};
+        const auto handle = open(file_name, O_RDONLY | O_CLOEXEC);
+        if (handle < 0) return false;
+        const auto bytes_read = pread(handle, signature, sizeof(signature), 0);
+        close(handle);
+        return ((bytes_read == sizeof(signature)) && (signature[0] == 0x1F) && (signature[1] == 0x8B));
+    #else
+        static_cast<void>(file_name);
+        return false;
+    #endif
+}
+
+/**
+ * The worker thread function that decompresses the whole file once and adds a checkpoint at the first deflate block
+ * boundary behind every HE_FILE_GZIP_SPAN bytes. The complete index is cached.
+ */
+void TFileGzip::Run() noexcept
+{
+    #if defined(HE_HAS_ZLIB)
+        std::vector<unsigned char> input;
+        std::vector<unsigned char> window;
+        auto success = true;
+        try
+        {
+            input.resize(HE_FILE_GZIP_CHUNK_SIZE);
+            window.resize(HE_FILE_GZIP_WINDOW_SIZE);
+        }
+        catch (const std::bad_alloc&)
+        {
+            success = false;
+        }
+
+        // Decode the gzip header automatically (47 = 15 + 32: the largest window and gzip or zlib detection)
+        z_stream stream = {};
+        if ((success) && (inflateInit2(&stream, 47) != Z_OK)) success = false;
+        const auto initialized = success;
+
+        // Decompress the file chunk by chunk, the output is written into the circular window
+        int64_t read_offset = 0;
+        int64_t total_out = 0;
+        int64_t member_out = 0;
+        auto ended = false;
+        while ((success) && (!ended))
+        {
+            // Check for termination
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+                if (this->stop_)
+                {
+                    success = false;
+                    break;
+                }
+            }
+
+            // Read the next chunk (the end of the file is only valid between two gzip members)
+            if (stream.avail_in == 0)
+            {
+                const auto bytes_read = pread(this->handle_, input.data(), input.size(), read_offset);
+                if ((bytes_read < 0) && (errno == EINTR)) continue;
+                if (bytes_read <= 0)
+                {
+                    success = ((bytes_read == 0) && (member_out == 0) && (total_out > 0));
+                    break;
+                }
+                read_offset += bytes_read;
+                stream.next_in = input.data();
+                stream.avail_in = static_cast<uInt>(bytes_read);
+            }
+
+            // Decompress the chunk, stopping at every block boundary
+            while ((success) && (stream.avail_in > 0))
+            {
+                if (stream.avail_out == 0)
+                {
+                    stream.next_out = window.data();
+                    stream.avail_out = HE_FILE_GZIP_WINDOW_SIZE;
+                }
+                const auto available = stream.avail_out;
+                const auto result = inflate(&stream, Z_BLOCK);
+                const auto produced = static_cast<int64_t>(available - stream.avail_out);
+                total_out += produced;
+                member_out += produced;
+
+                // A member ends, the next one may follow (data that is not a gzip member ends the file)
+                if (result == Z_STREAM_END)
+                {
+                    member_out = 0;
+                    success = (inflateReset(&stream) == Z_OK);
+                    continue;
+                }
+                if ((result != Z_OK) && (result != Z_BUF_ERROR))
+                {
+                    success = ((result == Z_DATA_ERROR) && (member_out == 0) && (total_out > 0));
+                    ended = true;
+                    break;
+                }
+
+                // Add a checkpoint at a block boundary (not behind the last block of a member)
+                if (((stream.data_type & 128) != 0) && ((stream.data_type & 64) == 0) &&
+                    ((this->checkpoints_.empty()) || (total_out - this->checkpoints_.back().out >= HE_FILE_GZIP_SPAN)))
+                {
+                    try
+                    {
+                        // The history is the end of the circular window (the oldest data) followed by its start
+                        TGzipCheckpoint checkpoint = { total_out, read_offset - static_cast<int64_t>(stream.avail_in), stream.data_type & 7, {} };
+                        const auto history = static_cast<std::size_t>(hedit_min(total_out, static_cast<int64_t>(HE_FILE_GZIP_WINDOW_SIZE)));
+                        const auto next = static_cast<std::size_t>(HE_FILE_GZIP_WINDOW_SIZE - stream.avail_out);
+                        checkpoint.window.insert(checkpoint.window.end(), window.begin() + next, window.end());
+                        checkpoint.window.insert(checkpoint.window.end(), window.begin(), window.begin() + next);
+                        checkpoint.window.erase(checkpoint.window.begin(), checkpoint.window.end() - history);
+                        std::lock_guard<std::mutex> lock(this->mutex_);
+                        this->checkpoints_.push_back(std::move(checkpoint));
+                    }
+                    catch (const std::bad_alloc&)
+                    {
+                        success = false;
+                    }
+                }
+            }
+
+            // Publish the decompressed length
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            this->length_ = total_out;
+            this->signal_.notify_all();
+        }
+        if (initialized) inflateEnd(&stream);
+
+        // Cache the complete index
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            this->length_ = total_out;
+        }
+        if (success) this->SaveIndex();
+
+        // Publish the result
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->success_ = success;
+        this->done_ = true;
+        this->signal_.notify_all();
+    #endif
+}
+
+/**
+ * Loads the cached index, if it matches the size and the modification time of the file.
+ * @return true on success, false if there is no valid index.
+ */
+bool TFileGzip::LoadIndex() noexcept
+{
+    #if defined(HE_HAS_ZLIB)
+        const auto file = fopen(this->index_name_, "rb");
+        if (file == nullptr) return false;
+
+        // Check the header
+        char magic[8] = {};
+        int64_t header[5] = {};
+        auto success = ((fread(magic, 1, sizeof(magic), file) == sizeof(magic)) && (memcmp(magic, HE_FILE_GZIP_INDEX_MAGIC, sizeof(magic)) == 0) &&
+            (fread(header, sizeof(int64_t), 5, file) == 5) && (header[0] == this->compressed_size_) && (header[1] == this->modification_time_) &&
+            (header[2] == HE_FILE_GZIP_SPAN) && (header[3] > 0) && (header[4] > 0) && (header[4] <= header[3] / HE_FILE_GZIP_SPAN + 1));
+
+        // Read the checkpoints (they must be in order and within the file)
+        std::deque<TGzipCheckpoint> checkpoints;
+        int64_t last_out = -1;
+        for (int64_t index = 0; (success) && (index < header[4]); index++)
+        {
+            TGzipCheckpoint checkpoint = { 0, 0, 0, {} };
+            int64_t position[2] = {};
+            int32_t values[2] = {};
+            success = ((fread(position, sizeof(int64_t), 2, file) == 2) && (fread(values, sizeof(int32_t), 2, file) == 2) &&
+                (position[0] > last_out) && (position[0] <= header[3]) && (position[1] > 0) && (position[1] <= this->compressed_size_) &&
+                (values[0] >= 0) && (values[0] < 8) && (values[1] >= 0) && (values[1] <= static_cast<int32_t>(HE_FILE_GZIP_WINDOW_SIZE)));
+            if (!success) break;
+            try
+            {
+                checkpoint.out = position[0];
+                checkpoint.in = position[1];
+                checkpoint.bits = values[0];
+                checkpoint.window.resize(static_cast<std::size_t>(values[1]));
+                success = (fread(checkpoint.window.data(), 1, checkpoint.window.size(), file) == checkpoint.window.size());
+                checkpoints.push_back(std::move(checkpoint));
+            }
+            catch (const std::bad_alloc&)
+            {
+                success = false;
+            }
+            last_out = position[0];
+        }
+        success = ((success) && (fgetc(file) == EOF));
+        fclose(file);
+        if (!success) return false;
+
+        // Use the index
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->checkpoints_.swap(checkpoints);
+        this->length_ = header[3];
+        this->success_ = true;
+        this->done_ = true;
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+/**
+ * Stores the complete index next to the file (a file that cannot be written is silently not cached).
+ */
+void TFileGzip::SaveIndex() noexcept
+{
+    #if defined(HE_HAS_ZLIB)
+        // The index is not changed while it is saved (the worker has completed it)
+        auto file = fopen(this->index_name_, "wb");
+        if (file == nullptr) return;
+
+        // Write the header and the checkpoints
+        const int64_t header[5] = { this->compressed_size_, this->modification_time_, HE_FILE_GZIP_SPAN, this->length_, static_cast<int64_t>(this->checkpoints_.size()) };
+        auto success = ((fwrite(HE_FILE_GZIP_INDEX_MAGIC, 1, 8, file) == 8) && (fwrite(header, sizeof(int64_t), 5, file) == 5));
+        for (const auto& checkpoint : this->checkpoints_)
+        {
+            const int64_t position[2] = { checkpoint.out, checkpoint.in };
+            const int32_t values[2] = { checkpoint.bits, static_cast<int32_t>(checkpoint.window.size()) };
+            success = ((success) && (fwrite(position, sizeof(int64_t), 2, file) == 2) && (fwrite(values, sizeof(int32_t), 2, file) == 2) &&
+                (fwrite(checkpoint.window.data(), 1, checkpoint.window.size(), file) == checkpoint.window.size()));
+        }
+
+        // An incomplete index is deleted
+        success = ((fclose(file) == 0) && (success));
+        if (!success) remove(this->index_name_);
+    #endif
+}
+
+/**
+ * Starts the decompression of the raw deflate data at the specified checkpoint.
+ * @param checkpoint The checkpoint to start at.
+ * @return true on success, false otherwise.
+ */
+bool TFileGzip::StartStream(const TGzipCheckpoint& checkpoint) noexcept
+{
+    #if defined(HE_HAS_ZLIB)
+        // Decompress raw deflate data (the gzip header is behind the checkpoint)
+        this->stream_ = {};
+        if (inflateInit2(&this->stream_, -15) != Z_OK) return false;
+        this->stream_active_ = true;
+        this->stream_raw_ = true;
+        this->stream_skip_ = 0;
+        this->stream_out_ = checkpoint.out;
+        this->stream_in_ = checkpoint.in;
+
+        // Feed the bits of the block that are stored in the byte in front of the checkpoint
+        if (checkpoint.bits != 0)
+        {
+            unsigned char value = 0;
+            if (pread(this->handle_, &value, 1, checkpoint.in - 1) != 1) return false;
+            if (inflatePrime(&this->stream_, checkpoint.bits, value >> (8 - checkpoint.bits)) != Z_OK) return false;
+        }
+
+        // Restore the history that the block may refer to
+        if (checkpoint.window.empty()) return true;
+        return (inflateSetDictionary(&this->stream_, checkpoint.window.data(), static_cast<uInt>(checkpoint.window.size())) == Z_OK);
+    #else
+        static_cast<void>(checkpoint);
+        return false;
+    #endif
+}
+
+/**
+ * Releases the decompressor of the last read.
+ */
+void TFileGzip::EndStream() noexcept
+{
+    #if defined(HE_HAS_ZLIB)
+        if (this->stream_active_) inflateEnd(&this->stream_);
+    #endif
+    this->stream_active_ = false;
+}
+
+/**
+ * Continues the decompression of the last read. Further gzip members are decompressed as well.
+ * @param buffer The buffer for the decompressed data.
+ * @param length The number of bytes to decompress.
+ * @return The number of bytes decompressed (less than the length at the end of the data or on errors).
+ */
+uint32_t TFileGzip::Inflate(unsigned char* buffer, uint32_t length) noexcept
+{
+    #if defined(HE_HAS_ZLIB)
+        this->stream_.next_out = buffer;
+        this->stream_.avail_out = length;
+        while (this->stream_.avail_out > 0)
+        {
+            // Read the next chunk
+            if (this->stream_.avail_in == 0)
+            {
+                const auto bytes_read = pread(this->handle_, this->input_.data(), this->input_.size(), this->stream_in_);
+                if ((bytes_read < 0) && (errno == EINTR)) continue;
+                if (bytes_read <= 0) break;
+                this->stream_in_ += bytes_read;
+                this->stream_.next_in = this->input_.data();
+                this->stream_.avail_in = static_cast<uInt>(bytes_read);
+            }
+
+            // Skip the trailer of a member that was decompressed as raw deflate data
+            if (this->stream_skip_ > 0)
+            {
+                const auto skip = hedit_min(this->stream_skip_, static_cast<uint32_t>(this->stream_.avail_in));
+                this->stream_.next_in += skip;
+                this->stream_.avail_in -= skip;
+                this->stream_skip_ -= skip;
+                continue;
+            }
+
+            // Decompress, the next member is decoded with its gzip header (and trailer)
+            const auto result = inflate(&this->stream_, Z_NO_FLUSH);
+            if (result == Z_STREAM_END)
+            {
+                if (this->stream_raw_) this->stream_skip_ = 8;
+                this->stream_raw_ = false;
+                if (inflateReset2(&this->stream_, 47) != Z_OK) break;
+                continue;
+            }
+            if ((result != Z_OK) && (result != Z_BUF_ERROR)) break;
+        }
+
+        // Return the number of bytes decompressed
+        const auto bytes_decompressed = length - this->stream_.avail_out;
+        this->stream_out_ += bytes_decompressed;
+        return bytes_decompressed;
+    #else
+        static_cast<void>(buffer);
+        static_cast<void>(length);
+        return 0;
+    #endif
+}
@@ -0,0 +1,83 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#ifndef HEDIT_SRC_FILE_GZIP_HPP_
+
+    // Header included
+    #define HEDIT_SRC_FILE_GZIP_HPP_
+
+    // The parameters of the index
+    constexpr int64_t HE_FILE_GZIP_SPAN = 4194304;                  //!< The minimum distance (in decompressed bytes) between two checkpoints of the index.
+    constexpr uint32_t HE_FILE_GZIP_WINDOW_SIZE = 32768;            //!< The size of the history (deflate window) that is stored with each checkpoint.
+    constexpr uint32_t HE_FILE_GZIP_CHUNK_SIZE = 65536;             //!< The number of compressed bytes that are read at once.
+    constexpr const char* const HE_FILE_GZIP_INDEX_SUFFIX = ".hidx";  //!< The suffix that is appended to the file name to get the name of the cached index.
+    constexpr const char* const HE_FILE_GZIP_INDEX_MAGIC = "HEGZIX01";  //!< The identification (and version) of the cached index.
+
+    /**
+     * @brief A checkpoint of the index, from which the decompression can be started.
+     */
+    struct TGzipCheckpoint
+    {
+        int64_t out;                        //!< The position of the checkpoint within the decompressed data.
+        int64_t in;                         //!< The offset of the first complete byte of the next deflate block within the compressed file.
+        int32_t bits;                       //!< The number of bits of the byte in front of the offset that belong to the next block (0 - 7).
+        std::vector<unsigned char> window;  //!< The last HE_FILE_GZIP_WINDOW_SIZE bytes of decompressed data in front of the checkpoint.
+    };
+
+    /**
+     * @brief The random access to the decompressed content of a gzip file (via zlib).
+     * @details A worker thread decompresses the file once and stores a checkpoint (the state of the decompressor) at
+     * a deflate block boundary every HE_FILE_GZIP_SPAN bytes. A read starts at the checkpoint in front of the position,
+     * so it decompresses at most one span (reads that follow each other continue the previous decompression). While
+     * the index is built, the content grows like a stream (see WaitFor()). The complete index is cached next to the file
+     * (HE_FILE_GZIP_INDEX_SUFFIX), so that the file can be opened again at once. Files that consist of several gzip
+     * members (concatenated files) are decompressed as a whole, trailing data that is not a gzip member is ignored.
+     */
+    class TFileGzip
+    {
+    private:
+        int handle_ = -1;                               //!< The handle of the compressed file (owned by the caller).
+        TString index_name_;                            //!< The name of the cached index.
+        int64_t compressed_size_ = 0;                   //!< The size of the compressed file (the cached index must match).
+        int64_t modification_time_ = 0;                 //!< The modification time of the compressed file (the cached index must match).
+        std::deque<TGzipCheckpoint> checkpoints_;       //!< The checkpoints (sorted by position, the deque keeps them in place while it grows).
+        int64_t length_ = 0;                            //!< The number of decompressed bytes that are indexed so far.
+        bool done_ = false;                             //!< The flag that specifies if the index is complete (or failed).
+        bool success_ = false;                          //!< The flag that specifies if the whole file was indexed successfully.
+        bool stop_ = false;                             //!< The flag that tells the worker thread to terminate.
+        std::thread worker_;                            //!< The worker thread that builds the index.
+        std::mutex mutex_;                              //!< The lock for the index.
+        std::condition_variable signal_;                //!< The signal for the progress of the index.
+        #if defined(HE_HAS_ZLIB)
+        z_stream stream_ = {};                          //!< The decompressor of the last read (continued by the next read, if possible).
+        #endif
+        bool stream_active_ = false;                    //!< The flag that specifies if the decompressor of the last read is initialized.
+        bool stream_raw_ = false;                       //!< The flag that specifies if the decompressor reads raw deflate data (started at a checkpoint).
+        int64_t stream_out_ = 0;                        //!< The position of the next decompressed byte.
+        int64_t stream_in_ = 0;                         //!< The offset of the next compressed byte that is to be read from the file.
+        uint32_t stream_skip_ = 0;                      //!< The number of compressed bytes to skip (the trailer of a gzip member).
+        std::vector<unsigned char> input_;              //!< The buffer for the compressed data of the reads.
+        std::vector<unsigned char> discard_;            //!< The buffer for the decompressed data that is skipped.
+    private:
+        void Run() noexcept;
+        bool LoadIndex() noexcept;
+        void SaveIndex() noexcept;
+        bool StartStream(const TGzipCheckpoint& checkpoint) noexcept;
+        void EndStream() noexcept;
+        uint32_t Inflate(unsigned char* buffer, uint32_t length) noexcept;
+    public:
+        explicit TFileGzip(const char* file_name);
+        TFileGzip(const TFileGzip& source) = delete;
+        TFileGzip& operator=(const TFileGzip& source) = delete;
+        TFileGzip(TFileGzip&&) = delete;
+        TFileGzip& operator=(TFileGzip&&) = delete;
+        ~TFileGzip();
+        bool Open(int handle) noexcept;
+        uint32_t Read(unsigned char* buffer, uint32_t length, int64_t position) noexcept;
+        int64_t WaitFor(int64_t end, int32_t timeout = -1) noexcept;
+        int64_t Length() noexcept;
+        bool IsDone() noexcept;
+        bool IsSuccessful() noexcept;
+        static bool IsCompressed(const char* file_name) noexcept;
+    };
+
+#endif  // HEDIT_SRC_FILE_GZIP_HPP_
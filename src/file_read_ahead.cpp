@@ -0,0 +1,331 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers.hpp"
+
+/**
+ * Creates a new (detached) read-ahead engine. The worker thread is started when the first page is requested.
+ * @param window The maximum number of pages that are read ahead (0 disables the read-ahead).
+ */
+TFileReadAhead::TFileReadAhead(uint32_t window) noexcept
+    : window_(hedit_min(window, HE_FILE_READ_AHEAD_PAGES))
+{
+}
+
+/**
+ * Destructor, stops the worker thread (a running read is completed first).
+ */
+TFileReadAhead::~TFileReadAhead()
+{
+    // Tell the worker to terminate
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->stop_ = true;
+        this->requests_.clear();
+    }
+    this->signal_.notify_all();
+
+    // Wait for the worker
+    if (this->worker_.joinable()) this->worker_.join();
+}
+
+/**
+ * Attaches the engine to an opened file. The handle must support positional reads and must stay open until Detach() is called.
+ * @param handle The handle the pages are read from.
+ * @param use_hints true to pass access hints to the system (for handles that use the system cache), false to do not.
+ */
+void TFileReadAhead::Attach(int handle, bool use_hints) noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    // Store the handle and start with a new access pattern
+    this->handle_ = handle;
+    this->use_hints_ = use_hints;
+    this->last_page_ = -1;
+    this->direction_ = 0;
+    this->streak_ = 0;
+    this->generation_++;
+}
+
+/**
+ * Detaches the engine from the file, dropping all requests and completed blocks. If the worker is reading a page,
+ * the function waits until the read is completed, so the handle can be closed afterwards.
+ */
+void TFileReadAhead::Detach() noexcept
+{
+    std::unique_lock<std::mutex> lock(this->mutex_);
+
+    // Drop the requests and forget the handle
+    this->requests_.clear();
+    this->handle_ = -1;
+    this->generation_++;
+
+    // Wait for a running read
+    this->signal_.wait(lock, [this] { return (this->active_page_ < 0); });
+
+    // Drop the completed blocks (keeping the memory)
+    for (auto& block : this->blocks_) this->spare_blocks_.push_back(std::move(block));
+    this->blocks_.clear();
+}
+
+/**
+ * Records an access of the specified page and detects the scan direction. Only page changes are counted, repeated
+ * accesses of the same page keep the current state.
+ * @param page_start The file offset of the accessed page.
+ * @return The scan direction (1 forward, -1 backward) if the page changed during a sequential scan, 0 otherwise.
+ */
+int32_t TFileReadAhead::Track(int64_t page_start) noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    // Check if read-ahead is possible and if the page changed
+    if ((this->window_ == 0) || (this->handle_ < 0) || (page_start == this->last_page_)) return 0;
+
+    // Check if the page follows the last page (in either direction)
+    int32_t direction = 0;
+    if ((this->last_page_ >= 0) && (page_start == this->last_page_ + HE_FILE_CACHE_PAGE_SIZE)) direction = 1;
+    if ((this->last_page_ >= 0) && (page_start == this->last_page_ - HE_FILE_CACHE_PAGE_SIZE)) direction = -1;
+    this->last_page_ = page_start;
+
+    // Continue or restart the streak (a direction change drops the requests for the old direction)
+    const auto was_sequential = (this->streak_ >= HE_FILE_READ_AHEAD_TRIGGER);
+    if ((direction != 0) && (direction == this->direction_))
+    {
+        this->streak_++;
+    }
+    else
+    {
+        this->requests_.clear();
+        this->direction_ = direction;
+        this->streak_ = (direction != 0) ? 1 : 0;
+    }
+    const auto is_sequential = (this->streak_ >= HE_FILE_READ_AHEAD_TRIGGER);
+
+    // Tell the system about the changed access pattern (forward scans use a larger system read-ahead)
+    #if defined(POSIX_FADV_SEQUENTIAL)
+        if ((this->use_hints_) && (is_sequential != was_sequential))
+        {
+            posix_fadvise(this->handle_, 0, 0, ((is_sequential) && (this->direction_ > 0)) ? POSIX_FADV_SEQUENTIAL : POSIX_FADV_NORMAL);
+        }
+    #else
+        static_cast<void>(was_sequential);
+    #endif
+
+    // Return the scan direction
+    return (is_sequential) ? this->direction_ : 0;
+}
+
+/**
+ * Requests the specified page to be read by the worker thread. Pages that are already requested are ignored.
+ * @param page_start The file offset of the page.
+ */
+void TFileReadAhead::Request(int64_t page_start) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+
+        // Ensure a file is attached and the page is not yet requested
+        if ((this->handle_ < 0) || (this->stop_) || (this->IsPending(page_start))) return;
+
+        // Start the worker thread on first use (if it cannot be started, read-ahead is disabled)
+        if (!this->worker_.joinable())
+        {
+            try
+            {
+                this->worker_ = std::thread(&TFileReadAhead::Run, this);
+            }
+            catch (const std::exception&)
+            {
+                this->window_ = 0;
+                return;
+            }
+        }
+
+        // Queue the request and let the system start reading
+        this->requests_.push_back(page_start);
+        this->Hint(page_start);
+    }
+    this->signal_.notify_all();
+}
+
+/**
+ * Waits until the specified page is read, if it was requested.
+ * @param page_start The file offset of the page.
+ * @return true if completed blocks are available (see Collect()), false otherwise.
+ */
+bool TFileReadAhead::Wait(int64_t page_start) noexcept
+{
+    std::unique_lock<std::mutex> lock(this->mutex_);
+
+    // Wait until the page is no longer pending
+    this->signal_.wait(lock, [this, page_start] { return !this->IsPending(page_start); });
+
+    // Return if blocks are available
+    return !this->blocks_.empty();
+}
+
+/**
+ * Takes a completed block. The caller becomes the owner of the block and should return its memory via Release().
+ * @param block Receives the block.
+ * @return true if a block was taken, false if no blocks are available.
+ */
+bool TFileReadAhead::Collect(TFileCachePage& block) noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    // Check if a block is available
+    if (this->blocks_.empty()) return false;
+
+    // Hand out the oldest block
+    block = std::move(this->blocks_.front());
+    this->blocks_.erase(this->blocks_.begin());
+    this->pages_read_++;
+    return true;
+}
+
+/**
+ * Returns the memory of a block, so that the memory can be reused for the next reads.
+ * @param block The block (any page with or without memory).
+ */
+void TFileReadAhead::Release(TFileCachePage&& block) noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    // Keep the memory, unless there is enough spare memory already
+    if ((!block.memory) || (this->spare_blocks_.size() >= this->window_)) return;
+    block.start = -1;
+    block.length = 0;
+    try
+    {
+        this->spare_blocks_.push_back(std::move(block));
+    }
+    catch (const std::bad_alloc&)
+    {
+        return;
+    }
+}
+
+/**
+ * Drops all requests and completed blocks, because the file content was changed. A running read is dropped when it is completed.
+ */
+void TFileReadAhead::Cancel() noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    // Start a new generation of the file content
+    this->generation_++;
+    this->requests_.clear();
+
+    // Drop the completed blocks (keeping the memory)
+    for (auto& block : this->blocks_) this->spare_blocks_.push_back(std::move(block));
+    this->blocks_.clear();
+}
+
+/**
+ * Returns the maximum number of pages that are read ahead.
+ * @return The number of pages (0 if read-ahead is disabled).
+ */
+uint32_t TFileReadAhead::GetWindow() const noexcept
+{
+    return this->window_;
+}
+
+/**
+ * Returns the number of pages that were read ahead and handed out to the cache.
+ * @return The number of pages.
+ */
+uint64_t TFileReadAhead::GetPagesRead() noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    return this->pages_read_;
+}
+
+/**
+ * The worker thread, reads the requested pages one by one until the engine is destroyed.
+ */
+void TFileReadAhead::Run() noexcept
+{
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    while (true)
+    {
+        // Wait for a request
+        this->signal_.wait(lock, [this] { return ((this->stop_) || (!this->requests_.empty())); });
+        if (this->stop_) break;
+
+        // Take the next request (and a block for the data)
+        const auto page_start = this->requests_.front();
+        this->requests_.pop_front();
+        const auto handle = this->handle_;
+        const auto generation = this->generation_;
+        this->active_page_ = page_start;
+        TFileCachePage block;
+        if (!this->spare_blocks_.empty())
+        {
+            block = std::move(this->spare_blocks_.back());
+            this->spare_blocks_.pop_back();
+        }
+        lock.unlock();
+
+        // Allocate the block memory on first use (aligned like the cache pages, as required for direct I/O)
+        if (!block.memory)
+        {
+            block.memory.reset(new (std::nothrow) unsigned char[HE_FILE_CACHE_PAGE_SIZE + HE_FILE_CACHE_ALIGNMENT]);
+            void* aligned_memory = block.memory.get();
+            std::size_t space = HE_FILE_CACHE_PAGE_SIZE + HE_FILE_CACHE_ALIGNMENT;
+            block.data = (aligned_memory != nullptr) ? static_cast<unsigned char*>(std::align(HE_FILE_CACHE_ALIGNMENT, HE_FILE_CACHE_PAGE_SIZE, aligned_memory, space)) : nullptr;
+        }
+
+        // Read the page without holding the lock
+        uint32_t bytes_read = 0;
+        #if !(defined(_WIN32) || defined(__WIN32__))
+            while ((block.data != nullptr) && (bytes_read < HE_FILE_CACHE_PAGE_SIZE))
+            {
+                const auto result = pread(handle, &block.data[bytes_read], HE_FILE_CACHE_PAGE_SIZE - bytes_read, page_start + bytes_read);
+                if ((result < 0) && (errno == EINTR)) continue;
+                if (result <= 0) break;
+                bytes_read += static_cast<uint32_t>(result);
+            }
+        #else
+            static_cast<void>(handle);
+        #endif
+
+        // Store the block, unless the file was changed or detached in the meantime
+        lock.lock();
+        this->active_page_ = -1;
+        if ((bytes_read > 0) && (generation == this->generation_))
+        {
+            block.start = page_start;
+            block.length = bytes_read;
+            this->blocks_.push_back(std::move(block));
+        }
+        else if (block.memory)
+        {
+            this->spare_blocks_.push_back(std::move(block));
+        }
+        this->signal_.notify_all();
+    }
+}
+
+/**
+ * Checks if the specified page is requested or currently read. The caller must hold the lock.
+ * @param page_start The file offset of the page.
+ * @return true if the page is pending, false otherwise.
+ */
+bool TFileReadAhead::IsPending(int64_t page_start) const noexcept
+{
+    if (this->active_page_ == page_start) return true;
+    return (std::find(this->requests_.begin(), this->requests_.end(), page_start) != this->requests_.end());
+}
+
+/**
+ * Tells the system that the specified page will be needed soon, so that the system can start reading it
+ * (this matters for backward scans, which are not detected by the system read-ahead). The caller must hold the lock.
+ * @param page_start The file offset of the page.
+ */
+void TFileReadAhead::Hint(int64_t page_start) const noexcept
+{
+    #if defined(POSIX_FADV_WILLNEED)
+        if (this->use_hints_) posix_fadvise(this->handle_, page_start, HE_FILE_CACHE_PAGE_SIZE, POSIX_FADV_WILLNEED);
+    #else
+        static_cast<void>(page_start);
+    #endif
+}
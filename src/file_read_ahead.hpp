@@ -0,0 +1,61 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#ifndef HEDIT_SRC_FILE_READ_AHEAD_HPP_
+
+    // Header included
+    #define HEDIT_SRC_FILE_READ_AHEAD_HPP_
+
+    // The parameters of the read-ahead engine
+    constexpr uint32_t HE_FILE_READ_AHEAD_PAGES = 8;    //!< The maximum number of cache pages that are read ahead of a sequential scan.
+    constexpr uint32_t HE_FILE_READ_AHEAD_TRIGGER = 2;  //!< The number of consecutive page changes in the same direction that start the read-ahead.
+
+    /**
+     * @brief The read-ahead engine that fills the cache pages ahead of sequential scans on a worker thread.
+     * @details The engine watches the sequence of the accessed cache pages. If the pages are accessed strictly forward or
+     * backward, the next pages in scan direction are read by a worker thread (using positional reads on the file handle),
+     * while the caller processes the current page. The completed blocks are collected by the file class and moved into
+     * the page cache. The worker never accesses the file object itself, so it only needs the engine's own lock.
+     */
+    class TFileReadAhead
+    {
+    private:
+        uint32_t window_;                          //!< The number of pages that are read ahead (0 disables the read-ahead).
+        int handle_ = -1;                          //!< The handle the blocks are read from (-1 if no file is attached).
+        bool use_hints_ = false;                   //!< The flag that specifies if access hints are passed to the system (not for direct I/O).
+        int64_t last_page_ = -1;                   //!< The file offset of the last accessed page.
+        int32_t direction_ = 0;                    //!< The detected scan direction (1 forward, -1 backward, 0 none).
+        uint32_t streak_ = 0;                      //!< The number of consecutive page changes in the detected direction.
+        uint64_t generation_ = 0;                  //!< The generation of the file content, increased by each write (blocks of older generations are dropped).
+        uint64_t pages_read_ = 0;                  //!< The number of pages that were read ahead and moved into the cache.
+        bool stop_ = false;                        //!< The flag that tells the worker thread to terminate.
+        int64_t active_page_ = -1;                 //!< The file offset of the page the worker is currently reading (-1 if idle).
+        std::deque<int64_t> requests_;             //!< The file offsets of the pages that are to be read.
+        std::vector<TFileCachePage> blocks_;       //!< The pages that were read and are waiting to be moved into the cache.
+        std::vector<TFileCachePage> spare_blocks_; //!< The unused pages (their memory is reused).
+        std::thread worker_;                       //!< The worker thread (started when the first page is requested).
+        std::mutex mutex_;                         //!< The lock for the requests and the completed blocks.
+        std::condition_variable signal_;           //!< The signal for new requests and completed blocks.
+    private:
+        void Run() noexcept;
+        bool IsPending(int64_t page_start) const noexcept;
+        void Hint(int64_t page_start) const noexcept;
+    public:
+        explicit TFileReadAhead(uint32_t window) noexcept;
+        TFileReadAhead(const TFileReadAhead& source) = delete;
+        TFileReadAhead& operator=(const TFileReadAhead& source) = delete;
+        TFileReadAhead(TFileReadAhead&&) = delete;
+        TFileReadAhead& operator=(TFileReadAhead&&) = delete;
+        ~TFileReadAhead();
+        void Attach(int handle, bool use_hints) noexcept;
+        void Detach() noexcept;
+        int32_t Track(int64_t page_start) noexcept;
+        void Request(int64_t page_start) noexcept;
+        bool Wait(int64_t page_start) noexcept;
+        bool Collect(TFileCachePage& block) noexcept;
+        void Release(TFileCachePage&& block) noexcept;
+        void Cancel() noexcept;
+        uint32_t GetWindow() const noexcept;
+        uint64_t GetPagesRead() noexcept;
+    };
+
+#endif  // HEDIT_SRC_FILE_READ_AHEAD_HPP_
@@ -0,0 +1,160 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers.hpp"
+
+/**
+ * Creates a snapshot object, the snapshot is taken by Start().
+ * @param source_name The name of the file.
+ * @param target_name The name of the snapshot (an existing file is overwritten).
+ */
+TFileSnapshot::TFileSnapshot(const char* source_name, const char* target_name)
+    : source_name_(source_name),
+    target_name_(target_name)
+{
+}
+
+/**
+ * Destructor, stops the worker thread and deletes an incomplete snapshot.
+ */
+TFileSnapshot::~TFileSnapshot()
+{
+    // Tell the worker to terminate
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->stop_ = true;
+    }
+
+    // Wait for the worker
+    if (this->worker_.joinable()) this->worker_.join();
+
+    // Delete an incomplete snapshot
+    if ((this->started_) && (!this->success_)) remove(this->target_name_);
+}
+
+/**
+ * Starts taking the snapshot: the file is cloned, if possible, otherwise the worker thread starts copying the file.
+ * @param length The length of the file.
+ * @return true on success, false otherwise.
+ */
+bool TFileSnapshot::Start(int64_t length) noexcept
+{
+    // Clone the file instantly, if possible
+    this->length_ = length;
+    this->started_ = true;
+    if (this->Clone())
+    {
+        this->cloned_ = true;
+        this->success_ = true;
+        this->done_ = true;
+        return true;
+    }
+
+    // Copy the file in the background
+    try
+    {
+        this->worker_ = std::thread(&TFileSnapshot::Run, this);
+    }
+    catch (const std::exception&)
+    {
+        this->done_ = true;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Waits until the snapshot is complete, reporting the progress of the copy.
+ * @param progress The receiver of the progress (nullptr if not required).
+ * @return true if the snapshot was taken successfully, false otherwise.
+ */
+bool TFileSnapshot::Wait(TFileProgress* progress) noexcept
+{
+    std::unique_lock<std::mutex> lock(this->mutex_);
+
+    // Report the progress until the copy is complete
+    if ((progress != nullptr) && (!this->done_)) progress->Progress(0, this->length_);
+    while (!this->done_)
+    {
+        this->signal_.wait_for(lock, std::chrono::milliseconds(100));
+        if ((progress != nullptr) && (this->bytes_copied_ > 0)) progress->Progress(this->bytes_copied_, this->length_);
+    }
+    return this->success_;
+}
+
+/**
+ * Returns true if the snapshot is complete (or failed), false if it is being copied.
+ * @return true if the snapshot is complete, false otherwise.
+ */
+bool TFileSnapshot::IsDone() noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    return this->done_;
+}
+
+/**
+ * Returns true if the snapshot was created as a copy-on-write clone of the file.
+ * @return true if the file was cloned, false otherwise.
+ */
+bool TFileSnapshot::IsCloned() const noexcept
+{
+    return this->cloned_;
+}
+
+/**
+ * Creates the snapshot as a copy-on-write clone of the file (ioctl() with FICLONE, Linux only),
+ * which takes no time and shares the data of both files until one of them is changed.
+ * @return true on success, false if not supported.
+ */
+bool TFileSnapshot::Clone() noexcept
+{
+    #if defined(__linux__) && defined(FICLONE)
+        // Open the file
+        const auto source = open(this->source_name_, O_RDONLY | O_CLOEXEC);
+        if (source < 0) return false;
+
+        // Create the clone with the permissions of the file
+        struct stat file_info = {};
+        auto success = (fstat(source, &file_info) == 0);
+        const auto target = (success) ? open(this->target_name_, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, file_info.st_mode & 0777) : -1;
+        success = ((target >= 0) && (ioctl(target, FICLONE, source) == 0));
+        if (target >= 0) close(target);
+        close(source);
+        return success;
+    #else
+        return false;
+    #endif
+}
+
+/**
+ * The worker thread function that copies the file block by block.
+ */
+void TFileSnapshot::Run() noexcept
+{
+    TFile source(this->source_name_, false);
+    TFile target(this->target_name_, false);
+
+    // Open both files
+    auto success = ((source.Open(TFileMode::READ)) && (target.Open(TFileMode::CREATE)));
+
+    // Copy block by block (within the kernel, if possible)
+    int64_t bytes_copied = 0;
+    while ((success) && (bytes_copied < this->length_))
+    {
+        const auto count = hedit_min(this->length_ - bytes_copied, HE_FILE_SNAPSHOT_BLOCK_SIZE);
+        success = (source.CopyTo(&target, bytes_copied, count, bytes_copied) == count);
+        bytes_copied += count;
+
+        // Publish the progress and check for termination
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->bytes_copied_ = bytes_copied;
+        if (this->stop_) success = false;
+        this->signal_.notify_all();
+    }
+    target.Close();
+
+    // Publish the result
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->success_ = success;
+    this->done_ = true;
+    this->signal_.notify_all();
+}
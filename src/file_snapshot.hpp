@@ -0,0 +1,50 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#ifndef HEDIT_SRC_FILE_SNAPSHOT_HPP_
+
+    // Header included
+    #define HEDIT_SRC_FILE_SNAPSHOT_HPP_
+
+    // The parameters of the snapshot
+    constexpr int64_t HE_FILE_SNAPSHOT_BLOCK_SIZE = 8388608;           //!< The number of bytes the worker copies between two checks for cancellation.
+    constexpr const char* const HE_FILE_SNAPSHOT_SUFFIX = ".bak";      //!< The suffix that is appended to the file name to get the name of the snapshot.
+
+    /**
+     * @brief The snapshot (backup copy) of a file that is taken before the file is changed for the first time.
+     * @details If the file system supports it (Linux: btrfs, xfs), the snapshot is created instantly as a copy-on-write
+     * clone of the file (ioctl() with FICLONE). Otherwise a worker thread copies the file block by block (within the kernel,
+     * if possible, see TFile::CopyTo(), which also shares the data on file systems that support it), so that the editor stays
+     * responsive. The file must not be changed before the snapshot is complete (see Wait()). An incomplete snapshot is deleted.
+     */
+    class TFileSnapshot
+    {
+    private:
+        TString source_name_;                  //!< The name of the file.
+        TString target_name_;                  //!< The name of the snapshot.
+        int64_t length_ = 0;                   //!< The length of the file.
+        int64_t bytes_copied_ = 0;             //!< The number of bytes copied so far.
+        bool started_ = false;                 //!< The flag that specifies if taking the snapshot was started.
+        bool cloned_ = false;                  //!< The flag that specifies if the snapshot was created as a clone.
+        bool done_ = false;                    //!< The flag that specifies if the snapshot is complete (or failed).
+        bool success_ = false;                 //!< The flag that specifies if the snapshot was created successfully.
+        bool stop_ = false;                    //!< The flag that tells the worker thread to terminate.
+        std::thread worker_;                   //!< The worker thread that copies the file (if the file cannot be cloned).
+        std::mutex mutex_;                     //!< The lock for the state of the copy.
+        std::condition_variable signal_;       //!< The signal for the progress of the copy.
+    private:
+        void Run() noexcept;
+        bool Clone() noexcept;
+    public:
+        TFileSnapshot(const char* source_name, const char* target_name);
+        TFileSnapshot(const TFileSnapshot& source) = delete;
+        TFileSnapshot& operator=(const TFileSnapshot& source) = delete;
+        TFileSnapshot(TFileSnapshot&&) = delete;
+        TFileSnapshot& operator=(TFileSnapshot&&) = delete;
+        ~TFileSnapshot();
+        bool Start(int64_t length) noexcept;
+        bool Wait(TFileProgress* progress) noexcept;
+        bool IsDone() noexcept;
+        bool IsCloned() const noexcept;
+    };
+
+#endif  // HEDIT_SRC_FILE_SNAPSHOT_HPP_
@@ -0,0 +1,224 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers.hpp"
+
+// The handle of the standard input, once it is taken over
+int TFileSpool::stdin_handle_ = -1;
+
+/**
+ * Destructor, stops the worker thread and closes the stream.
+ */
+TFileSpool::~TFileSpool()
+{
+    // Tell the worker to terminate
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->stop_ = true;
+    }
+
+    // Wait for the worker
+    if (this->worker_.joinable()) this->worker_.join();
+
+    // Close the stream
+    #if !(defined(_WIN32) || defined(__WIN32__))
+        if (this->input_handle_ >= 0) close(this->input_handle_);
+    #endif
+}
+
+/**
+ * Opens the specified stream and starts copying it into the specified temporary file.
+ * @param file_name The name of the stream (HE_FILE_SPOOL_STDIN for the standard input).
+ * @param spool_handle The handle of the (empty) temporary file, which must stay open until the spool is destroyed.
+ * @return true on success, false otherwise.
+ */
+bool TFileSpool::Start(const char* file_name, int spool_handle) noexcept
+{
+    #if !(defined(_WIN32) || defined(__WIN32__))
+        // Open the stream (the standard input is taken over only once)
+        if (strcmp(file_name, HE_FILE_SPOOL_STDIN) == 0)
+        {
+            this->input_handle_ = TFileSpool::stdin_handle_;
+            TFileSpool::stdin_handle_ = -1;
+        }
+        else
+        {
+            this->input_handle_ = open(file_name, O_RDONLY | O_CLOEXEC);
+        }
+        if (this->input_handle_ < 0) return false;
+        this->spool_handle_ = spool_handle;
+
+        // Copy the stream in the background
+        try
+        {
+            this->worker_ = std::thread(&TFileSpool::Run, this);
+        }
+        catch (const std::exception&)
+        {
+            this->done_ = true;
+            return false;
+        }
+        return true;
+    #else
+        static_cast<void>(file_name);
+        static_cast<void>(spool_handle);
+        return false;
+    #endif
+}
+
+/**
+ * Waits until the data up to the specified end has arrived or the stream has ended.
+ * @param end The end of the range that is needed.
+ * @param timeout The maximum time to wait (in ms), -1 to wait until the data has arrived.
+ * @return The number of bytes that have arrived.
+ */
+int64_t TFileSpool::WaitFor(int64_t end, int32_t timeout) noexcept
+{
+    std::unique_lock<std::mutex> lock(this->mutex_);
+
+    // Wait for the data
+    const auto has_arrived = [this, end]() { return ((this->done_) || (this->length_ >= end)); };
+    if (timeout < 0)
+        this->signal_.wait(lock, has_arrived);
+    else
+        this->signal_.wait_for(lock, std::chrono::milliseconds(timeout), has_arrived);
+    return this->length_;
+}
+
+/**
+ * Returns the number of bytes that have arrived so far.
+ * @return The number of bytes that have arrived.
+ */
+int64_t TFileSpool::Length() noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    return this->length_;
+}
+
+/**
+ * Returns true if the stream has ended (or failed), false if the data is still arriving.
+ * @return true if the stream has ended, false otherwise.
+ */
+bool TFileSpool::IsDone() noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    return this->done_;
+}
+
+/**
+ * Returns true if the whole stream was read successfully, false if it is still arriving or if it failed.
+ * @return true if the stream was read successfully, false otherwise.
+ */
+bool TFileSpool::IsSuccessful() noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    return ((this->done_) && (this->success_));
+}
+
+/**
+ * Returns true if the specified file is a stream that cannot be read at arbitrary positions, which is the standard
+ * input (HE_FILE_SPOOL_STDIN) or a pipe (e.g. a named pipe or a process substitution of the shell).
+ * @param file_name The name of the file.
+ * @return true if the file is a stream, false otherwise.
+ */
+bool TFileSpool::IsStream(const char* file_name) noexcept
+{
+    #if !(defined(_WIN32) || defined(__WIN32__))
+        struct stat file_info = {};
+        if (strcmp(file_name, HE_FILE_SPOOL_STDIN) == 0) return true;
+        return ((stat(file_name, &file_info) == 0) && (S_ISFIFO(file_info.st_mode)));
+    #else
+        static_cast<void>(file_name);
+        return false;
+    #endif
+}
+
+/**
+ * Takes over the standard input, if it is not a terminal (e.g. "xz -dc dump.xz | hedit -"), so that it can be read
+ * as the file HE_FILE_SPOOL_STDIN, and reopens the standard input on the terminal for the keyboard input.
+ * Must be called before the console is initialized.
+ */
+void TFileSpool::RedirectStdin() noexcept
+{
+    #if !(defined(_WIN32) || defined(__WIN32__))
+        // Check if the standard input is a stream that is not yet taken over
+        if ((TFileSpool::stdin_handle_ >= 0) || (isatty(STDIN_FILENO))) return;
+
+        // Keep the stream and attach the standard input to the terminal
+        const auto terminal = open("/dev/tty", O_RDONLY | O_CLOEXEC);
+        if (terminal < 0) return;
+        TFileSpool::stdin_handle_ = fcntl(STDIN_FILENO, F_DUPFD_CLOEXEC, 0);
+        if (TFileSpool::stdin_handle_ >= 0) dup2(terminal, STDIN_FILENO);
+        close(terminal);
+    #endif
+}
+
+/**
+ * The worker thread function that appends the data of the stream to the temporary file as it arrives.
+ */
+void TFileSpool::Run() noexcept
+{
+    #if !(defined(_WIN32) || defined(__WIN32__))
+        std::vector<unsigned char> block;
+        auto success = true;
+        try
+        {
+            block.resize(HE_FILE_SPOOL_BLOCK_SIZE);
+        }
+        catch (const std::bad_alloc&)
+        {
+            success = false;
+        }
+
+        // Copy the data until the stream ends
+        int64_t length = 0;
+        while (success)
+        {
+            // Check for termination
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+                if (this->stop_) break;
+            }
+
+            // Wait for data (regularly checking for termination)
+            pollfd poll_info = { this->input_handle_, POLLIN, 0 };
+            const auto ready = poll(&poll_info, 1, HE_FILE_SPOOL_POLL_INTERVAL);
+            if ((ready < 0) && (errno == EINTR)) continue;
+            if (ready <= 0)
+            {
+                success = (ready == 0);
+                continue;
+            }
+
+            // Read the available data (0 bytes mark the end of the stream)
+            const auto bytes_read = read(this->input_handle_, block.data(), block.size());
+            if ((bytes_read < 0) && ((errno == EINTR) || (errno == EAGAIN))) continue;
+            if (bytes_read <= 0)
+            {
+                success = (bytes_read == 0);
+                break;
+            }
+
+            // Append the data to the temporary file
+            ssize_t bytes_written = 0;
+            while ((success) && (bytes_written < bytes_read))
+            {
+                const auto result = pwrite(this->spool_handle_, &block[static_cast<std::size_t>(bytes_written)], static_cast<std::size_t>(bytes_read - bytes_written), length + bytes_written);
+                if ((result < 0) && (errno == EINTR)) continue;
+                success = (result > 0);
+                if (success) bytes_written += result;
+            }
+            length += bytes_written;
+
+            // Publish the new data
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            this->length_ = length;
+            this->signal_.notify_all();
+        }
+
+        // Publish the result
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->success_ = ((success) && (!this->stop_));
+        this->done_ = true;
+        this->signal_.notify_all();
+    #endif
+}
@@ -0,0 +1,50 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#ifndef HEDIT_SRC_FILE_SPOOL_HPP_
+
+    // Header included
+    #define HEDIT_SRC_FILE_SPOOL_HPP_
+
+    // The parameters of the spool
+    constexpr uint32_t HE_FILE_SPOOL_BLOCK_SIZE = 1048576;     //!< The maximum number of bytes that are read from the stream at once.
+    constexpr int32_t HE_FILE_SPOOL_POLL_INTERVAL = 100;       //!< The time (in ms) after which the worker checks for termination while it waits for data.
+    constexpr const char* const HE_FILE_SPOOL_STDIN = "-";     //!< The file name that stands for the standard input.
+
+    /**
+     * @brief The spool that copies a stream (the standard input or a pipe) into a temporary file on a worker thread.
+     * @details Streams cannot be read at arbitrary positions, so the data is appended to an anonymous temporary file
+     * (see TFile::Open()) as it arrives, and read from there. Readers wait until the range they need has arrived or the
+     * stream has ended (see WaitFor()), so the first pages can be viewed while the rest of the stream is still arriving.
+     */
+    class TFileSpool
+    {
+    private:
+        int input_handle_ = -1;                //!< The handle of the stream.
+        int spool_handle_ = -1;                //!< The handle of the temporary file (owned by the caller).
+        int64_t length_ = 0;                   //!< The number of bytes that have arrived so far.
+        bool done_ = false;                    //!< The flag that specifies if the stream has ended (or failed).
+        bool success_ = false;                 //!< The flag that specifies if the whole stream was read successfully.
+        bool stop_ = false;                    //!< The flag that tells the worker thread to terminate.
+        std::thread worker_;                   //!< The worker thread that copies the stream.
+        std::mutex mutex_;                     //!< The lock for the state of the copy.
+        std::condition_variable signal_;       //!< The signal for the arrival of data.
+        static int stdin_handle_;              //!< The handle of the standard input, once it is taken over (see RedirectStdin()).
+    private:
+        void Run() noexcept;
+    public:
+        TFileSpool() = default;
+        TFileSpool(const TFileSpool& source) = delete;
+        TFileSpool& operator=(const TFileSpool& source) = delete;
+        TFileSpool(TFileSpool&&) = delete;
+        TFileSpool& operator=(TFileSpool&&) = delete;
+        ~TFileSpool();
+        bool Start(const char* file_name, int spool_handle) noexcept;
+        int64_t WaitFor(int64_t end, int32_t timeout = -1) noexcept;
+        int64_t Length() noexcept;
+        bool IsDone() noexcept;
+        bool IsSuccessful() noexcept;
+        static bool IsStream(const char* file_name) noexcept;
+        static void RedirectStdin() noexcept;
+    };
+
+#endif  // HEDIT_SRC_FILE_SPOOL_HPP_
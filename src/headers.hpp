@@ -12,6 +12,26 @@
         #include <unistd.h>
         #include <dirent.h>
         #include <ncurses.h>
+        #include <fcntl.h>
+        #include <poll.h>
+        #include <signal.h>
+        #include <setjmp.h>
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+        #include <sys/ioctl.h>
+        #if defined(__linux__)
+            #include <linux/fs.h>
+            #include <sys/sendfile.h>
+        #endif
+
+        // The system call copy_file_range() is available since glibc 2.27
+        #if defined(__linux__) && defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 27)))
+            #define HE_HAS_COPY_FILE_RANGE
+        #endif
+
+        // Gzip files are decompressed via zlib (link with -lz)
+        #include <zlib.h>
+        #define HE_HAS_ZLIB
 
         // Enable 64bit support for lange files
         #define _FILE_OFFSET_BITS 64
@@ -93,8 +113,29 @@
     #include <cinttypes>
     #include <vector>
     #include <map>
+    #include <deque>
+    #include <algorithm>
+    #include <mutex>
+    #include <thread>
+    #include <condition_variable>
+    #include <chrono>
+    #include <cerrno>
     #include <utility>
 
+    // SIMD instructions for the search (x86 only, AVX2 is used if the processor supports it, see TSearchMatcher)
+    #if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+        #include <immintrin.h>
+        #define HE_HAS_SSE2
+        #define HE_HAS_AVX2
+        #define HE_TARGET_AVX2 __attribute__((target("avx2")))
+    #elif defined(_MSC_VER) && !defined(__BORLANDC__) && (defined(_M_X64) || defined(_M_AMD64))
+        #include <intrin.h>
+        #include <immintrin.h>
+        #define HE_HAS_SSE2
+        #define HE_HAS_AVX2
+        #define HE_TARGET_AVX2
+    #endif
+
     // The maximum number of file editors in one HEdit window (also used by the comparator engine).
     constexpr int32_t HE_MAX_EDITORS = 5;
 
@@ -105,7 +146,17 @@
 
     // Include the HEdit header files
     #include "string.hpp"
+    #include "file_cache.hpp"
+    #include "file_read_ahead.hpp"
+    #include "piece_table.hpp"
     #include "file.hpp"
+    #include "file_snapshot.hpp"
+    #include "file_spool.hpp"
+    #include "file_gzip.hpp"
+    #include "clipboard.hpp"
+    #include "search_matcher.hpp"
+    #include "search_engine.hpp"
+    #include "search_pool.hpp"
     #include "console.hpp"
     #include "window.hpp"
     #include "message_box.hpp"
@@ -0,0 +1,469 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers.hpp"
+
+/**
+ * Creates an empty piece table (see Reset()).
+ */
+TPieceTable::TPieceTable() noexcept
+    : root_(nullptr),
+    added_data_(),
+    original_size_(0),
+    piece_count_(0),
+    seed_(0x9E3779B9),
+    modified_(false)
+{
+}
+
+/**
+ * Drops all changes and starts with a single piece that covers the whole file.
+ * @param file_size The size of the file content.
+ * @return true on success, false otherwise (the table is empty then).
+ */
+bool TPieceTable::Reset(int64_t file_size) noexcept
+{
+    // Drop the pieces and the added data
+    this->root_.reset();
+    this->added_data_.clear();
+    this->added_data_.shrink_to_fit();
+    this->original_size_ = 0;
+    this->piece_count_ = 0;
+    this->modified_ = false;
+
+    // An empty file has no pieces
+    if (file_size <= 0) return true;
+
+    // Create the piece of the file
+    try
+    {
+        this->root_.reset(new TPieceNode());
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+    this->root_->piece = { TPieceSource::FILE, 0, file_size };
+    this->root_->priority = this->NextPriority();
+    this->root_->size = file_size;
+    this->original_size_ = file_size;
+    this->piece_count_ = 1;
+    return true;
+}
+
+/**
+ * Inserts the specified data at the specified position, shifting the following data.
+ * @param position The zero-based position to insert at (up to the size of the content).
+ * @param buffer The data to insert or nullptr to insert zeros.
+ * @param length The number of bytes to insert.
+ * @return true on success, false otherwise.
+ */
+bool TPieceTable::Insert(int64_t position, const unsigned char* buffer, int64_t length) noexcept
+{
+    TPiece piece = { TPieceSource::ZERO, 0, length };
+    if ((buffer != nullptr) && (!this->Store(buffer, length, piece))) return false;
+    return this->Change(position, 0, piece);
+}
+
+/**
+ * Erases the specified range, shifting the following data.
+ * @param position The zero-based position of the first byte to erase.
+ * @param length The number of bytes to erase (limited to the end of the content).
+ * @return true on success, false otherwise.
+ */
+bool TPieceTable::Erase(int64_t position, int64_t length) noexcept
+{
+    if ((position < 0) || (length < 0) || (position > this->Size())) return false;
+    return this->Change(position, hedit_min(length, this->Size() - position), { TPieceSource::ZERO, 0, 0 });
+}
+
+/**
+ * Overwrites the data at the specified position. Data behind the end of the content extends the content,
+ * a gap between the end of the content and the position is filled with zeros.
+ * @param position The zero-based position to write at.
+ * @param buffer The new data or nullptr to write zeros.
+ * @param length The number of bytes to write.
+ * @return true on success, false otherwise.
+ */
+bool TPieceTable::Replace(int64_t position, const unsigned char* buffer, int64_t length) noexcept
+{
+    TPiece piece = { TPieceSource::ZERO, 0, length };
+    if ((buffer != nullptr) && (!this->Store(buffer, length, piece))) return false;
+    return this->ChangeRange(position, piece);
+}
+
+/**
+ * Overwrites the specified range with repeated copies of the specified buffer (like Replace()). The buffer is
+ * stored only once and each copy is a piece that refers to it, so that large ranges take little memory.
+ * @param position The zero-based position to write at.
+ * @param buffer The data to repeat or nullptr to write zeros.
+ * @param buffer_length The length of the buffer.
+ * @param length The number of bytes to write (the last copy of the buffer is truncated).
+ * @return true on success, false otherwise (the range may be partially written then).
+ */
+bool TPieceTable::Fill(int64_t position, const unsigned char* buffer, int64_t buffer_length, int64_t length) noexcept
+{
+    // Zeros need no data at all
+    if (buffer == nullptr) return this->Replace(position, nullptr, length);
+    if ((position < 0) || (buffer_length <= 0)) return false;
+
+    // Store the buffer once
+    TPiece piece = { TPieceSource::ZERO, 0, 0 };
+    if (!this->Store(buffer, hedit_min(buffer_length, length), piece)) return false;
+
+    // Overwrite the range copy by copy
+    int64_t bytes_filled = 0;
+    while (bytes_filled < length)
+    {
+        piece.length = hedit_min(buffer_length, length - bytes_filled);
+        if (!this->ChangeRange(position + bytes_filled, piece)) return false;
+        bytes_filled += piece.length;
+    }
+    return true;
+}
+
+/**
+ * Finds the piece that contains the specified position.
+ * @param position The zero-based position within the content.
+ * @param piece Receives the piece.
+ * @param piece_start Receives the position of the first byte of the piece.
+ * @return true if the piece was found, false if the position is behind the end of the content.
+ */
+bool TPieceTable::Find(int64_t position, TPiece& piece, int64_t& piece_start) const noexcept
+{
+    // Ensure a valid position
+    if ((position < 0) || (position >= this->Size())) return false;
+
+    // Descend to the piece, summing up the lengths of the skipped pieces
+    piece_start = 0;
+    auto node = this->root_.get();
+    while (node != nullptr)
+    {
+        const auto left_size = SizeOf(node->left.get());
+        if (position < left_size)
+        {
+            node = node->left.get();
+        }
+        else if (position < left_size + node->piece.length)
+        {
+            piece = node->piece;
+            piece_start += left_size;
+            return true;
+        }
+        else
+        {
+            position -= left_size + node->piece.length;
+            piece_start += left_size + node->piece.length;
+            node = node->right.get();
+        }
+    }
+    return false;
+}
+
+/**
+ * Returns the added data at the specified offset. The data is valid until the next change.
+ * @param offset The offset within the added data (see TPiece).
+ * @return The added data.
+ */
+const unsigned char* TPieceTable::GetAddedData(int64_t offset) const noexcept
+{
+    return &this->added_data_[static_cast<std::size_t>(offset)];
+}
+
+/**
+ * Returns all pieces in the order of the content.
+ * @return The pieces.
+ */
+std::vector<TPiece> TPieceTable::GetPieces() const
+{
+    std::vector<TPiece> pieces;
+    pieces.reserve(this->piece_count_);
+    CollectPieces(this->root_.get(), pieces);
+    return pieces;
+}
+
+/**
+ * Returns the number of pieces the content consists of.
+ * @return The number of pieces.
+ */
+std::size_t TPieceTable::GetPieceCount() const noexcept
+{
+    return this->piece_count_;
+}
+
+/**
+ * Returns the size of the file content the table was created for (see Reset()).
+ * @return The size of the original content (in bytes).
+ */
+int64_t TPieceTable::GetOriginalSize() const noexcept
+{
+    return this->original_size_;
+}
+
+/**
+ * Returns the size of the edited content.
+ * @return The size of the content (in bytes).
+ */
+int64_t TPieceTable::Size() const noexcept
+{
+    return SizeOf(this->root_.get());
+}
+
+/**
+ * Returns true if the content was changed since the last reset, false otherwise.
+ * @return true if the content was changed, false otherwise.
+ */
+bool TPieceTable::IsModified() const noexcept
+{
+    return this->modified_;
+}
+
+/**
+ * Stores the specified data in the buffer of the added data and returns the piece that refers to it.
+ * @param buffer The data to store.
+ * @param length The length of the data.
+ * @param piece Receives the piece of the stored data.
+ * @return true on success, false otherwise.
+ */
+bool TPieceTable::Store(const unsigned char* buffer, int64_t length, TPiece& piece) noexcept
+{
+    if (length < 0) return false;
+    piece = { TPieceSource::ADDED, static_cast<int64_t>(this->added_data_.size()), length };
+    try
+    {
+        this->added_data_.insert(this->added_data_.end(), buffer, &buffer[length]);
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Exchanges the range that is covered by the specified piece at the specified position by the piece (see Replace()).
+ * @param position The zero-based position of the range.
+ * @param piece The new piece.
+ * @return true on success, false otherwise.
+ */
+bool TPieceTable::ChangeRange(int64_t position, const TPiece& piece) noexcept
+{
+    // Fill the gap behind the end of the content
+    const auto size = this->Size();
+    if ((position > size) && (!this->Change(size, 0, { TPieceSource::ZERO, 0, position - size }))) return false;
+
+    // Exchange the overwritten range
+    const auto erase_length = hedit_max(hedit_min(piece.length, this->Size() - position), 0);
+    return this->Change(position, erase_length, piece);
+}
+
+/**
+ * Exchanges the specified range by a new piece. All memory is allocated before the tree is changed,
+ * so that the tree is left unchanged if the memory is exhausted.
+ * @param position The zero-based position of the range.
+ * @param erase_length The length of the range to remove (0 to insert only).
+ * @param piece The new piece (with a length of 0 to erase only), added data must be stored already (see Store()).
+ * @return true on success, false otherwise.
+ */
+bool TPieceTable::Change(int64_t position, int64_t erase_length, const TPiece& piece) noexcept
+{
+    // Ensure a valid range
+    const auto size = this->Size();
+    const auto length = piece.length;
+    if ((position < 0) || (erase_length < 0) || (length < 0) || (position > size) || (erase_length > size - position)) return false;
+    if ((erase_length == 0) && (length == 0)) return true;
+
+    // Allocate the nodes for splitting the pieces at the range boundaries and for the new piece
+    std::unique_ptr<TPieceNode> spare_nodes[2];
+    std::unique_ptr<TPieceNode> new_node;
+    try
+    {
+        spare_nodes[0].reset(new TPieceNode());
+        spare_nodes[1].reset(new TPieceNode());
+        if (length > 0) new_node.reset(new TPieceNode());
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    // Cut the tree into the pieces in front of, within and behind the range
+    std::unique_ptr<TPieceNode> left;
+    std::unique_ptr<TPieceNode> middle;
+    std::unique_ptr<TPieceNode> right;
+    Split(std::move(this->root_), position, left, right, spare_nodes[0]);
+    Split(std::move(right), erase_length, middle, right, spare_nodes[1]);
+
+    // Drop the pieces of the range (split pieces took a spare node)
+    this->piece_count_ -= CountNodes(middle.get());
+    this->piece_count_ += (spare_nodes[0]) ? 0 : 1;
+    this->piece_count_ += (spare_nodes[1]) ? 0 : 1;
+    middle.reset();
+
+    // Add the new piece, unless it continues the previous piece (e.g. while typing)
+    if ((length > 0) && (!Extend(left.get(), piece.source, piece.offset, length)))
+    {
+        new_node->piece = piece;
+        new_node->priority = this->NextPriority();
+        new_node->size = length;
+        left = Merge(std::move(left), std::move(new_node));
+        this->piece_count_++;
+    }
+
+    // Join the tree again
+    this->root_ = Merge(std::move(left), std::move(right));
+    this->modified_ = true;
+    return true;
+}
+
+/**
+ * Returns the next random priority for a new node (xorshift generator).
+ * @return The priority.
+ */
+uint32_t TPieceTable::NextPriority() noexcept
+{
+    this->seed_ ^= this->seed_ << 13;
+    this->seed_ ^= this->seed_ >> 17;
+    this->seed_ ^= this->seed_ << 5;
+    return this->seed_;
+}
+
+/**
+ * Returns the total length of the pieces in the specified subtree.
+ * @param node The root of the subtree (may be nullptr).
+ * @return The length (in bytes).
+ */
+int64_t TPieceTable::SizeOf(const TPieceNode* node) noexcept
+{
+    return (node != nullptr) ? node->size : 0;
+}
+
+/**
+ * Recalculates the subtree size of the specified node after its children were changed.
+ * @param node The node.
+ */
+void TPieceTable::Update(TPieceNode* node) noexcept
+{
+    node->size = SizeOf(node->left.get()) + node->piece.length + SizeOf(node->right.get());
+}
+
+/**
+ * Splits the specified subtree into the pieces in front of and behind the specified position. A piece that
+ * contains the position is split into two pieces, the second piece is stored in the spare node.
+ * @param node The root of the subtree (ownership is taken).
+ * @param position The position to split at (relative to the subtree).
+ * @param left Receives the subtree with the pieces in front of the position.
+ * @param right Receives the subtree with the pieces behind the position.
+ * @param spare The node for the second part of a split piece (reset, if used).
+ */
+void TPieceTable::Split(std::unique_ptr<TPieceNode> node, int64_t position, std::unique_ptr<TPieceNode>& left, std::unique_ptr<TPieceNode>& right, std::unique_ptr<TPieceNode>& spare) noexcept
+{
+    // An empty subtree has no pieces
+    if (!node)
+    {
+        left.reset();
+        right.reset();
+        return;
+    }
+
+    const auto left_size = SizeOf(node->left.get());
+    if (position <= left_size)
+    {
+        // The position lies within the left subtree, the node belongs to the right part
+        Split(std::move(node->left), position, left, node->left, spare);
+        Update(node.get());
+        right = std::move(node);
+    }
+    else if (position >= left_size + node->piece.length)
+    {
+        // The position lies within the right subtree, the node belongs to the left part
+        Split(std::move(node->right), position - left_size - node->piece.length, node->right, right, spare);
+        Update(node.get());
+        left = std::move(node);
+    }
+    else
+    {
+        // The position lies within the piece: the node keeps the head and the left subtree, the spare node takes the tail and the right subtree
+        const auto head_length = position - left_size;
+        right = std::move(spare);
+        right->piece = { node->piece.source, node->piece.offset + head_length, node->piece.length - head_length };
+        right->priority = node->priority;
+        right->left.reset();
+        right->right = std::move(node->right);
+        Update(right.get());
+        node->piece.length = head_length;
+        Update(node.get());
+        left = std::move(node);
+    }
+}
+
+/**
+ * Joins two subtrees, all pieces of the left subtree are placed in front of the pieces of the right subtree.
+ * @param left The subtree with the first pieces (ownership is taken).
+ * @param right The subtree with the last pieces (ownership is taken).
+ * @return The joined tree.
+ */
+std::unique_ptr<TPieceNode> TPieceTable::Merge(std::unique_ptr<TPieceNode> left, std::unique_ptr<TPieceNode> right) noexcept
+{
+    // Check for empty subtrees
+    if (!left) return right;
+    if (!right) return left;
+
+    // The node with the higher priority becomes the root
+    if (left->priority > right->priority)
+    {
+        left->right = Merge(std::move(left->right), std::move(right));
+        Update(left.get());
+        return left;
+    }
+    right->left = Merge(std::move(left), std::move(right->left));
+    Update(right.get());
+    return right;
+}
+
+/**
+ * Extends the last piece of the specified subtree by the specified data, if the data directly follows the data of the piece.
+ * @param node The root of the subtree (may be nullptr).
+ * @param source The source of the data (see TPieceSource).
+ * @param offset The offset of the data within the source.
+ * @param length The length of the data.
+ * @return true if the piece was extended, false otherwise.
+ */
+bool TPieceTable::Extend(TPieceNode* node, TPieceSource source, int64_t offset, int64_t length) noexcept
+{
+    // Find the last piece
+    if (node == nullptr) return false;
+    auto last = node;
+    while (last->right) last = last->right.get();
+
+    // Check if the data follows the data of the piece
+    if ((last->piece.source != source) || (source == TPieceSource::FILE)) return false;
+    if ((source == TPieceSource::ADDED) && (last->piece.offset + last->piece.length != offset)) return false;
+
+    // Extend the piece and the sizes of the subtrees on the way to the piece
+    for (auto item = node; item != nullptr; item = item->right.get()) item->size += length;
+    last->piece.length += length;
+    return true;
+}
+
+/**
+ * Counts the nodes of the specified subtree.
+ * @param node The root of the subtree (may be nullptr).
+ * @return The number of nodes.
+ */
+std::size_t TPieceTable::CountNodes(const TPieceNode* node) noexcept
+{
+    return (node != nullptr) ? (1 + CountNodes(node->left.get()) + CountNodes(node->right.get())) : 0;
+}
+
+/**
+ * Appends the pieces of the specified subtree (in order) to the specified list.
+ * @param node The root of the subtree (may be nullptr).
+ * @param pieces The list of pieces.
+ */
+void TPieceTable::CollectPieces(const TPieceNode* node, std::vector<TPiece>& pieces)
+{
+    if (node == nullptr) return;
+    CollectPieces(node->left.get(), pieces);
+    pieces.push_back(node->piece);
+    CollectPieces(node->right.get(), pieces);
+}
@@ -0,0 +1,86 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#ifndef HEDIT_SRC_PIECE_TABLE_HPP_
+
+    // Header included
+    #define HEDIT_SRC_PIECE_TABLE_HPP_
+
+    // The sources of the piece data
+    enum class TPieceSource : int32_t {
+        FILE,   //!< The data is stored in the file (the offset is a file offset).
+        ADDED,  //!< The data was added in memory (the offset refers to the buffer of the added data).
+        ZERO    //!< The data consists of zeros only (no data is stored at all).
+    };
+
+    /**
+     * @brief A piece of the edited content, which is a range of either the file or the added data.
+     */
+    struct TPiece
+    {
+        TPieceSource source;  //!< The source of the data (see TPieceSource).
+        int64_t offset;       //!< The offset of the data within the source.
+        int64_t length;       //!< The length of the data (in bytes).
+    };
+
+    /**
+     * @brief A node of the piece tree, holding one piece.
+     */
+    struct TPieceNode
+    {
+        TPiece piece = {};                          //!< The piece of the node.
+        int64_t size = 0;                           //!< The total length of all pieces in the subtree of the node (in bytes).
+        uint32_t priority = 0;                      //!< The random priority of the node (a parent has a higher priority than its children).
+        std::unique_ptr<TPieceNode> left = {};      //!< The subtree with the pieces in front of the piece.
+        std::unique_ptr<TPieceNode> right = {};     //!< The subtree with the pieces behind the piece.
+    };
+
+    /**
+     * @brief The piece table that collects the changes of a file in memory.
+     * @details The edited content is described by a sequence of pieces, each of them refers to a range of the file
+     * or to data that was added in memory. Initially, a single piece covers the whole file. Inserting, erasing
+     * and replacing data splits the pieces at the range boundaries and exchanges the pieces in between, the file
+     * itself is never touched. The pieces are kept in a randomized search tree (treap) that is ordered by the
+     * position of the pieces, so each change and each lookup takes O(log n) steps for n pieces.
+     */
+    class TPieceTable
+    {
+    private:
+        std::unique_ptr<TPieceNode> root_;         //!< The root of the piece tree.
+        std::vector<unsigned char> added_data_;    //!< The data that was added in memory (only appended, never changed).
+        int64_t original_size_;                    //!< The size of the file content the table was created for.
+        std::size_t piece_count_;                  //!< The number of pieces in the tree.
+        uint32_t seed_;                            //!< The state of the generator for the node priorities.
+        bool modified_;                            //!< The flag that specifies if the content was changed.
+    private:
+        bool Change(int64_t position, int64_t erase_length, const TPiece& piece) noexcept;
+        bool ChangeRange(int64_t position, const TPiece& piece) noexcept;
+        bool Store(const unsigned char* buffer, int64_t length, TPiece& piece) noexcept;
+        uint32_t NextPriority() noexcept;
+        static int64_t SizeOf(const TPieceNode* node) noexcept;
+        static void Update(TPieceNode* node) noexcept;
+        static void Split(std::unique_ptr<TPieceNode> node, int64_t position, std::unique_ptr<TPieceNode>& left, std::unique_ptr<TPieceNode>& right, std::unique_ptr<TPieceNode>& spare) noexcept;
+        static std::unique_ptr<TPieceNode> Merge(std::unique_ptr<TPieceNode> left, std::unique_ptr<TPieceNode> right) noexcept;
+        static bool Extend(TPieceNode* node, TPieceSource source, int64_t offset, int64_t length) noexcept;
+        static std::size_t CountNodes(const TPieceNode* node) noexcept;
+        static void CollectPieces(const TPieceNode* node, std::vector<TPiece>& pieces);
+    public:
+        TPieceTable() noexcept;
+        TPieceTable(const TPieceTable& source) = delete;
+        TPieceTable& operator=(const TPieceTable& source) = delete;
+        TPieceTable(TPieceTable&&) = delete;
+        TPieceTable& operator=(TPieceTable&&) = delete;
+        bool Reset(int64_t file_size) noexcept;
+        bool Insert(int64_t position, const unsigned char* buffer, int64_t length) noexcept;
+        bool Erase(int64_t position, int64_t length) noexcept;
+        bool Replace(int64_t position, const unsigned char* buffer, int64_t length) noexcept;
+        bool Fill(int64_t position, const unsigned char* buffer, int64_t buffer_length, int64_t length) noexcept;
+        bool Find(int64_t position, TPiece& piece, int64_t& piece_start) const noexcept;
+        const unsigned char* GetAddedData(int64_t offset) const noexcept;
+        std::vector<TPiece> GetPieces() const;
+        std::size_t GetPieceCount() const noexcept;
+        int64_t GetOriginalSize() const noexcept;
+        int64_t Size() const noexcept;
+        bool IsModified() const noexcept;
+    };
+
+#endif  // HEDIT_SRC_PIECE_TABLE_HPP_
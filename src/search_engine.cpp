@@ -0,0 +1,195 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers.hpp"
+
+/**
+ * Creates a search engine for the specified mode, the files are added via AddFile().
+ * @param mode The search mode (see TSearchMode).
+ */
+TSearchEngine::TSearchEngine(TSearchMode mode) noexcept
+    : mode_(mode)
+{
+}
+
+/**
+ * Adds a file to search. The modes that compare the files (HEX_COMPARING and ANY_DIFFERENCE) search all added files,
+ * the other modes search the first file only.
+ * @param file The file to search.
+ * @param pattern The search string for the file (the lower and the higher value for TSearchMode::HEX_RANGE).
+ * @param pattern_length The length of the search string (2 for TSearchMode::HEX_RANGE).
+ * @return true on success, false otherwise.
+ */
+bool TSearchEngine::AddFile(TFile* file, const unsigned char* pattern, std::size_t pattern_length) noexcept
+{
+    if (this->files_ >= HE_MAX_EDITORS) return false;
+    try
+    {
+        this->pattern_[this->files_].assign(pattern, pattern + pattern_length);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+    this->file_[this->files_++] = file;
+
+    // The exact search string of the first file is found via the matcher
+    if ((this->files_ == 1) && (this->UsesMatcher()) && (!this->matcher_.Prepare(pattern, pattern_length, this->mode_ == TSearchMode::TEXT_CI))) return false;
+
+    // The range of a single byte is checked at each position, the search strings are checked completely
+    if ((this->mode_ != TSearchMode::HEX_RANGE) && (this->mode_ != TSearchMode::PROBABLE_WORD)) this->window_length_ = hedit_max(this->window_length_, pattern_length);
+    return true;
+}
+
+/**
+ * Sets the characters that may make up a probable word and the minimum length of a word (TSearchMode::PROBABLE_WORD).
+ * @param char_set The null-terminated string with the characters of a word (binary zeros never belong to a word).
+ * @param word_length The number of characters that make up a word.
+ */
+void TSearchEngine::SetWordCharSet(const char* char_set, std::size_t word_length) noexcept
+{
+    for (std::size_t i = 0; i < sizeof(this->word_chars_); i++) this->word_chars_[i] = ((i != 0) && (strchr(char_set, static_cast<int>(i)) != nullptr));
+    this->window_length_ = hedit_max(word_length, static_cast<std::size_t>(1));
+}
+
+/**
+ * Searches the specified positions of the files. The positions are checked in the search direction.
+ * Positions that are too close to the end of a file (the search string does not fit) do not match.
+ * @param position The first position to check (the highest position, if searching backward).
+ * @param count The number of positions to check (at most HE_SEARCH_BLOCK_SIZE).
+ * @param direction The search direction (see TSearchDirection).
+ * @param match Receives the position of the first match in the search direction.
+ * @return true if a match was found, false otherwise (TSearchMode::COUNT counts the matches, see Counter()).
+ */
+bool TSearchEngine::Search(int64_t position, int64_t count, TSearchDirection direction, int64_t& match) noexcept
+{
+    // Ensure a valid range
+    if ((this->files_ == 0) || (count <= 0) || (count > HE_SEARCH_BLOCK_SIZE)) return false;
+    const auto low = (direction == TSearchDirection::BACKWARD) ? position - count + 1 : position;
+    if (low < 0) return false;
+
+    // Read the block of each file (including the bytes that the search string covers behind the last position)
+    const auto multiple_files = ((this->mode_ == TSearchMode::HEX_COMPARING) || (this->mode_ == TSearchMode::ANY_DIFFERENCE));
+    const auto files = (multiple_files) ? this->files_ : 1;
+    const auto length = static_cast<uint32_t>(count) + static_cast<uint32_t>(this->window_length_) - 1;
+    auto available = static_cast<std::size_t>(length);
+    for (int32_t i = 0; i < files; i++)
+    {
+        try
+        {
+            if (this->block_[i].size() < length) this->block_[i].resize(length);
+        }
+        catch (const std::bad_alloc&)
+        {
+            return false;
+        }
+        available = hedit_min(available, static_cast<std::size_t>(this->file_[i]->PRead(this->block_[i].data(), length, low)));
+    }
+
+    // Only the positions whose bytes were read completely can match
+    if (available < this->window_length_) return false;
+    const auto positions = available - this->window_length_ + 1;
+
+    // Find the search string via the matcher, from the end of the block if searching backward (the matches are counted in TSearchMode::COUNT)
+    if (this->UsesMatcher())
+    {
+        const auto data = this->block_[0].data();
+        if (this->mode_ == TSearchMode::COUNT)
+        {
+            for (auto offset = this->matcher_.Find(data, 0, positions); offset < positions; offset = this->matcher_.Find(data, offset + 1, positions)) this->counter_++;
+            return false;
+        }
+        const auto offset = (direction == TSearchDirection::BACKWARD) ? this->matcher_.FindLast(data, 0, positions) : this->matcher_.Find(data, 0, positions);
+        if (offset >= positions) return false;
+        match = low + static_cast<int64_t>(offset);
+        return true;
+    }
+
+    // Check the positions in the search direction
+    if (direction == TSearchDirection::BACKWARD)
+    {
+        for (auto offset = positions; offset > 0; offset--)
+        {
+            if (!this->Matches(offset - 1)) continue;
+            match = low + static_cast<int64_t>(offset - 1);
+            return true;
+        }
+        return false;
+    }
+    for (std::size_t offset = 0; offset < positions; offset++)
+    {
+        if (!this->Matches(offset)) continue;
+        match = low + static_cast<int64_t>(offset);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Returns the number of bytes that are checked at each position (the length of the longest search string).
+ * @return The number of bytes that are checked at each position.
+ */
+std::size_t TSearchEngine::WindowLength() const noexcept
+{
+    return this->window_length_;
+}
+
+/**
+ * Returns the number of matches counted so far (TSearchMode::COUNT).
+ * @return The number of matches.
+ */
+int64_t TSearchEngine::Counter() const noexcept
+{
+    return this->counter_;
+}
+
+/**
+ * Checks if the search string of the mode is found via the matcher (a text or hex string in the first file).
+ * @return true if the matcher is used, false if the positions are checked one by one (see Matches()).
+ */
+bool TSearchEngine::UsesMatcher() const noexcept
+{
+    return ((this->mode_ == TSearchMode::TEXT_CS) || (this->mode_ == TSearchMode::TEXT_CI) || (this->mode_ == TSearchMode::UNICODE_TEXT) || (this->mode_ == TSearchMode::HEX_STRING) || (this->mode_ == TSearchMode::COUNT));
+}
+
+/**
+ * Checks if the files meet the search criteria at the specified offset within the current block
+ * (for the modes that do not use the matcher, see UsesMatcher()).
+ * @param offset The offset within the blocks.
+ * @return true on a match, false otherwise.
+ */
+bool TSearchEngine::Matches(std::size_t offset) const noexcept
+{
+    const auto data = &this->block_[0][offset];
+    const auto& pattern = this->pattern_[0];
+    switch (this->mode_)
+    {
+        case TSearchMode::HEX_RANGE:
+            return ((pattern.size() >= 2) && (data[0] >= pattern[0]) && (data[0] <= pattern[1]));
+        case TSearchMode::HEX_COMPARING:
+            for (int32_t i = 0; i < this->files_; i++)
+            {
+                if (memcmp(&this->block_[i][offset], this->pattern_[i].data(), this->pattern_[i].size()) != 0) return false;
+            }
+            return true;
+        case TSearchMode::ANY_DIFFERENCE:
+            for (int32_t i = 0; i < this->files_ - 1; i++)
+            {
+                if (this->block_[i][offset] != this->block_[i + 1][offset]) return true;
+            }
+            return false;
+        case TSearchMode::PROBABLE_WORD:
+            for (std::size_t i = 0; i < this->window_length_; i++)
+            {
+                if (!this->word_chars_[data[i]]) return false;
+            }
+            return true;
+        case TSearchMode::TEXT_CS:
+        case TSearchMode::TEXT_CI:
+        case TSearchMode::UNICODE_TEXT:
+        case TSearchMode::HEX_STRING:
+        case TSearchMode::COUNT:
+        case TSearchMode::NONE:
+            break;
+    }
+    return false;
+}
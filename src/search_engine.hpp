@@ -0,0 +1,63 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#ifndef HEDIT_SRC_SEARCH_ENGINE_HPP_
+
+    // Header included
+    #define HEDIT_SRC_SEARCH_ENGINE_HPP_
+
+    // The size of the blocks that are searched in memory
+    constexpr int64_t HE_SEARCH_BLOCK_SIZE = 1048576;  //!< The maximum number of positions that are searched per block (between two progress updates and checks for cancellation).
+
+    // Search directions
+    enum class TSearchDirection : int32_t {
+        FORWARD,    //!< The direction for the search operations: Forward
+        BACKWARD    //!< The direction for the search operations: Backward
+    };
+
+    // Search modes
+    enum class TSearchMode : int32_t {
+        NONE,              //!< Search mode: None (no active search)
+        TEXT_CS,           //!< Search mode: ASCII Text (case sensitive)
+        TEXT_CI,           //!< Search mode: ASCII Text (case insensitive, only the letters A-Z are matched regardless of case, all other bytes exactly)
+        UNICODE_TEXT,      //!< Search mode: Unicode (UCS-2) Text (case sensitive)
+        HEX_STRING,        //!< Search mode: String specified as hex characters.
+        HEX_RANGE,         //!< Search mode: A single hex character in the specified range.
+        HEX_COMPARING,     //!< Search mode: Comparing Hex: A hex character or string with the specified value at the same location in all open files.
+        ANY_DIFFERENCE,    //!< Search mode: Any difference between the open files.
+        PROBABLE_WORD,     //!< Search mode: A word (of specified length) that contains only the characters specified via config file.
+        COUNT,             //!< Search mode: Counts the number of ocurrences of the search character or string.
+    };
+
+    /**
+     * @brief The engine that searches the files block by block.
+     * @details Each call of Search() reads one block of up to HE_SEARCH_BLOCK_SIZE positions from every file (plus the
+     * bytes behind the last position that the search string covers, so that matches across two blocks are found) and
+     * checks the positions of the block in memory. The caller skips the holes of sparse files, waits for the data of
+     * streams and reports the progress between the blocks. The modes that compare the files (HEX_COMPARING and
+     * ANY_DIFFERENCE) read the same block from all files, the other modes search the first file only.
+     */
+    class TSearchEngine
+    {
+    private:
+        TSearchMode mode_;                                          //!< The search mode (see TSearchMode).
+        int32_t files_ = 0;                                         //!< The number of files that are searched.
+        TFile* file_[HE_MAX_EDITORS] = { nullptr };                 //!< The files that are searched.
+        std::vector<unsigned char> pattern_[HE_MAX_EDITORS];        //!< The search string of each file (the lower and the higher value for HEX_RANGE).
+        std::vector<unsigned char> block_[HE_MAX_EDITORS];          //!< The buffer for the current block of each file.
+        std::size_t window_length_ = 1;                             //!< The number of bytes that are checked at each position.
+        bool word_chars_[256] = {};                                 //!< The characters that may make up a probable word (see SetWordCharSet()).
+        int64_t counter_ = 0;                                       //!< The number of matches counted in TSearchMode::COUNT.
+        TSearchMatcher matcher_;                                    //!< The matcher for the search strings of the text and hex modes (see UsesMatcher()).
+    private:
+        bool Matches(std::size_t offset) const noexcept;
+        bool UsesMatcher() const noexcept;
+    public:
+        explicit TSearchEngine(TSearchMode mode) noexcept;
+        bool AddFile(TFile* file, const unsigned char* pattern, std::size_t pattern_length) noexcept;
+        void SetWordCharSet(const char* char_set, std::size_t word_length) noexcept;
+        bool Search(int64_t position, int64_t count, TSearchDirection direction, int64_t& match) noexcept;
+        std::size_t WindowLength() const noexcept;
+        int64_t Counter() const noexcept;
+    };
+
+#endif  // HEDIT_SRC_SEARCH_ENGINE_HPP_
@@ -0,0 +1,497 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers.hpp"
+
+#if defined(HE_HAS_SSE2)
+/**
+ * Returns the index of the lowest set bit of the specified mask (the mask must not be zero).
+ * @param mask The mask.
+ * @return The index of the lowest set bit.
+ */
+static inline uint32_t LowestBit(uint32_t mask) noexcept
+{
+    #if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index = 0;
+        _BitScanForward(&index, mask);
+        return static_cast<uint32_t>(index);
+    #else
+        return static_cast<uint32_t>(__builtin_ctz(mask));
+    #endif
+}
+
+/**
+ * Returns the index of the highest set bit of the specified mask (the mask must not be zero).
+ * @param mask The mask.
+ * @return The index of the highest set bit.
+ */
+static inline uint32_t HighestBit(uint32_t mask) noexcept
+{
+    #if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index = 0;
+        _BitScanReverse(&index, mask);
+        return static_cast<uint32_t>(index);
+    #else
+        return 31u - static_cast<uint32_t>(__builtin_clz(mask));
+    #endif
+}
+#endif
+
+/**
+ * Prepares the matcher for the specified pattern: the anchors and the Horspool shifts are calculated.
+ * @param pattern The pattern to find.
+ * @param length The length of the pattern (at least 1 byte).
+ * @param ignore_case true if the letters A-Z match regardless of case, false if all bytes must match exactly.
+ * @param path The implementation to use (see TSearchMatcherPath), by default the fastest one that the processor supports.
+ * Patterns of HE_SEARCH_HORSPOOL_LENGTH bytes and more (and all case insensitive patterns) are searched via Horspool instead of memchr().
+ * @return true on success, false otherwise.
+ */
+bool TSearchMatcher::Prepare(const unsigned char* pattern, std::size_t length, bool ignore_case, TSearchMatcherPath path) noexcept
+{
+    // Store the pattern (in lower case, if the case is ignored)
+    if (length == 0) return false;
+    try
+    {
+        this->pattern_.assign(pattern, pattern + length);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+    this->ignore_case_ = ignore_case;
+    if (ignore_case)
+    {
+        for (auto& value : this->pattern_) value = TSearchMatcher::Fold(value);
+    }
+    pattern = this->pattern_.data();
+
+    // Select the rarest and the second rarest byte (at different offsets) as anchors
+    this->anchor1_ = 0;
+    for (std::size_t i = 1; i < length; i++)
+    {
+        if (TSearchMatcher::ByteFrequency(pattern[i]) < TSearchMatcher::ByteFrequency(pattern[this->anchor1_])) this->anchor1_ = i;
+    }
+    this->anchor2_ = (this->anchor1_ == 0) ? hedit_min(static_cast<std::size_t>(1), length - 1) : 0;
+    for (std::size_t i = 0; i < length; i++)
+    {
+        if ((i != this->anchor1_) && (TSearchMatcher::ByteFrequency(pattern[i]) < TSearchMatcher::ByteFrequency(pattern[this->anchor2_]))) this->anchor2_ = i;
+    }
+
+    // The anchors that are letters are lowered before comparing them, if the case is ignored
+    const auto is_letter1 = ((pattern[this->anchor1_] >= 'a') && (pattern[this->anchor1_] <= 'z'));
+    const auto is_letter2 = ((pattern[this->anchor2_] >= 'a') && (pattern[this->anchor2_] <= 'z'));
+    this->case_mask1_ = ((ignore_case) && (is_letter1)) ? 0x20 : 0x00;
+    this->case_mask2_ = ((ignore_case) && (is_letter2)) ? 0x20 : 0x00;
+
+    // Calculate the Horspool shifts (by the last occurrence of each byte in front of the last byte, in both cases)
+    for (auto& shift : this->shift_) shift = length;
+    for (std::size_t i = 0; i + 1 < length; i++)
+    {
+        this->shift_[pattern[i]] = length - 1 - i;
+        if ((ignore_case) && (pattern[i] >= 'a') && (pattern[i] <= 'z')) this->shift_[pattern[i] - 0x20] = length - 1 - i;
+    }
+
+    // Calculate the reverse Horspool shifts (by the first occurrence of each byte behind the first byte, in both cases)
+    for (auto& shift : this->reverse_shift_) shift = length;
+    for (std::size_t i = length - 1; i > 0; i--)
+    {
+        this->reverse_shift_[pattern[i]] = i;
+        if ((ignore_case) && (pattern[i] >= 'a') && (pattern[i] <= 'z')) this->reverse_shift_[pattern[i] - 0x20] = i;
+    }
+
+    // Long patterns are skipped through faster than memchr() finds the anchor (which cannot find both cases)
+    const auto use_horspool = ((length >= HE_SEARCH_HORSPOOL_LENGTH) || (ignore_case));
+    this->path_ = ((path == TSearchMatcherPath::SCALAR) && (use_horspool)) ? TSearchMatcherPath::HORSPOOL : path;
+    return true;
+}
+
+/**
+ * Finds the first match of the pattern within the specified positions of the data.
+ * @param data The data, which must contain the positions plus the length of the pattern minus one bytes.
+ * @param start The first position to check.
+ * @param positions The number of positions of the data (the position behind the last position to check).
+ * @return The position of the first match or the number of positions, if there is no match.
+ */
+std::size_t TSearchMatcher::Find(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept
+{
+    if ((start >= positions) || (this->pattern_.empty())) return positions;
+    switch (this->path_)
+    {
+        #if defined(HE_HAS_AVX2)
+        case TSearchMatcherPath::AVX2:
+            return this->FindAvx2(data, start, positions);
+        #endif
+        #if defined(HE_HAS_SSE2)
+        case TSearchMatcherPath::SSE2:
+            return this->FindSse2(data, start, positions);
+        #endif
+        case TSearchMatcherPath::HORSPOOL:
+            return this->FindHorspool(data, start, positions);
+        default:
+            return this->FindScalar(data, start, positions);
+    }
+}
+
+/**
+ * Finds the last match of the pattern within the specified positions of the data (for backward searches).
+ * @param data The data, which must contain the positions plus the length of the pattern minus one bytes.
+ * @param start The lowest position to check.
+ * @param positions The number of positions of the data (the position behind the highest position to check).
+ * @return The position of the last match or the number of positions, if there is no match.
+ */
+std::size_t TSearchMatcher::FindLast(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept
+{
+    if ((start >= positions) || (this->pattern_.empty())) return positions;
+    switch (this->path_)
+    {
+        #if defined(HE_HAS_AVX2)
+        case TSearchMatcherPath::AVX2:
+            return this->FindLastAvx2(data, start, positions);
+        #endif
+        #if defined(HE_HAS_SSE2)
+        case TSearchMatcherPath::SSE2:
+            return this->FindLastSse2(data, start, positions);
+        #endif
+        case TSearchMatcherPath::HORSPOOL:
+            return this->FindLastHorspool(data, start, positions);
+        default:
+            return this->FindLastScalar(data, start, positions);
+    }
+}
+
+/**
+ * Checks if the pattern matches the specified data.
+ * @param data The data, which must contain the length of the pattern.
+ * @return true on a match, false otherwise.
+ */
+bool TSearchMatcher::Matches(const unsigned char* data) const noexcept
+{
+    if (!this->ignore_case_) return (memcmp(data, this->pattern_.data(), this->pattern_.size()) == 0);
+    for (std::size_t i = 0; i < this->pattern_.size(); i++)
+    {
+        if (TSearchMatcher::Fold(data[i]) != this->pattern_[i]) return false;
+    }
+    return true;
+}
+
+/**
+ * Returns the length of the pattern.
+ * @return The length of the pattern.
+ */
+std::size_t TSearchMatcher::Length() const noexcept
+{
+    return this->pattern_.size();
+}
+
+/**
+ * Returns the implementation that is used (see Prepare()).
+ * @return The implementation that is used.
+ */
+TSearchMatcherPath TSearchMatcher::Path() const noexcept
+{
+    return this->path_;
+}
+
+/**
+ * Returns the fastest implementation that is supported by the processor (checked once).
+ * @return The fastest implementation.
+ */
+TSearchMatcherPath TSearchMatcher::DetectPath() noexcept
+{
+    static const auto path = []() noexcept
+    {
+        #if defined(HE_HAS_AVX2) && defined(_MSC_VER) && !defined(__clang__)
+            // AVX2 must be supported by the processor (CPUID 7, EBX bit 5) and the registers must be saved by the OS (XCR0)
+            int info[4] = {};
+            __cpuid(info, 0);
+            const auto max_leaf = info[0];
+            __cpuid(info, 1);
+            const auto os_saves_ymm = (((info[2] & (1 << 27)) != 0) && ((_xgetbv(0) & 6) == 6));
+            if ((max_leaf >= 7) && (os_saves_ymm))
+            {
+                __cpuidex(info, 7, 0);
+                if ((info[1] & (1 << 5)) != 0) return TSearchMatcherPath::AVX2;
+            }
+        #elif defined(HE_HAS_AVX2)
+            if (__builtin_cpu_supports("avx2")) return TSearchMatcherPath::AVX2;
+        #endif
+        #if defined(HE_HAS_SSE2)
+            return TSearchMatcherPath::SSE2;
+        #else
+            return TSearchMatcherPath::SCALAR;
+        #endif
+    }();
+    return path;
+}
+
+/**
+ * Returns the typical frequency of the specified byte in text and binary data (a rank, higher values are more frequent).
+ * @param value The byte.
+ * @return The frequency rank of the byte.
+ */
+int32_t TSearchMatcher::ByteFrequency(unsigned char value) noexcept
+{
+    // The letters of English text, by frequency
+    static const char* const letters = "etaoinshrdlcumwfgypbvkjxqz";
+
+    // Zeros and filled areas dominate binary data, spaces and lower case letters dominate text
+    if (value == 0x00) return 255;
+    if (value == 0xFF) return 250;
+    if (value == ' ') return 245;
+    if ((value >= 'a') && (value <= 'z')) return 240 - static_cast<int32_t>(strchr(letters, value) - letters) * 4;
+    if ((value == '\n') || (value == '\r') || (value == '\t')) return 170;
+    if ((value >= '0') && (value <= '9')) return 160;
+    if ((value >= 'A') && (value <= 'Z')) return 150 - static_cast<int32_t>(strchr(letters, value - 'A' + 'a') - letters) * 2;
+    if ((value == 0x01) || (value == 0x80) || (value == 0xFE)) return 110;
+    if ((value > ' ') && (value < 0x7F)) return 100;
+    if (value < ' ') return 80;
+    return 60;
+}
+
+/**
+ * Returns the specified byte in lower case (only the letters A-Z are changed, the other bytes are returned as is).
+ * @param value The byte.
+ * @return The byte in lower case.
+ */
+unsigned char TSearchMatcher::Fold(unsigned char value) noexcept
+{
+    return ((value >= 'A') && (value <= 'Z')) ? static_cast<unsigned char>(value + 0x20) : value;
+}
+
+/**
+ * Finds the first match via memchr() on the rarest byte, verifying each hit.
+ * @param data The data.
+ * @param start The first position to check.
+ * @param positions The number of positions.
+ * @return The position of the first match or the number of positions, if there is no match.
+ */
+std::size_t TSearchMatcher::FindScalar(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept
+{
+    const auto length = this->pattern_.size();
+    const auto anchor = this->pattern_[this->anchor1_];
+    auto position = start;
+    while (position < positions)
+    {
+        // Find the next candidate (the anchor byte at its offset)
+        const auto hit = static_cast<const unsigned char*>(memchr(&data[position + this->anchor1_], anchor, positions - position));
+        if (hit == nullptr) break;
+        position = static_cast<std::size_t>(hit - data) - this->anchor1_;
+
+        // Verify the candidate
+        if (memcmp(&data[position], this->pattern_.data(), length) == 0) return position;
+        position++;
+    }
+    return positions;
+}
+
+/**
+ * Finds the first match via the Boyer-Moore-Horspool algorithm.
+ * @param data The data.
+ * @param start The first position to check.
+ * @param positions The number of positions.
+ * @return The position of the first match or the number of positions, if there is no match.
+ */
+std::size_t TSearchMatcher::FindHorspool(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept
+{
+    const auto last = this->pattern_.size() - 1;
+    const auto last_byte = this->pattern_[last];
+    auto position = start;
+    while (position < positions)
+    {
+        // Compare the last byte first, then the rest of the pattern
+        const auto value = data[position + last];
+        const auto last_matches = ((value == last_byte) || ((this->ignore_case_) && (TSearchMatcher::Fold(value) == last_byte)));
+        if ((last_matches) && (this->Matches(&data[position]))) return position;
+
+        // Align the next occurrence of the byte within the pattern
+        position += this->shift_[value];
+    }
+    return positions;
+}
+
+/**
+ * Finds the last match by checking the rarest byte at each position from the end, verifying each hit.
+ * @param data The data.
+ * @param start The lowest position to check.
+ * @param positions The number of positions.
+ * @return The position of the last match or the number of positions, if there is no match.
+ */
+std::size_t TSearchMatcher::FindLastScalar(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept
+{
+    const auto length = this->pattern_.size();
+    const auto anchor = this->pattern_[this->anchor1_];
+    const auto anchor_data = &data[this->anchor1_];
+    for (auto position = positions; position > start; position--)
+    {
+        if ((anchor_data[position - 1] == anchor) && (memcmp(&data[position - 1], this->pattern_.data(), length) == 0)) return position - 1;
+    }
+    return positions;
+}
+
+/**
+ * Finds the last match via the reverse Boyer-Moore-Horspool algorithm (the window moves towards the start of the data).
+ * @param data The data.
+ * @param start The lowest position to check.
+ * @param positions The number of positions.
+ * @return The position of the last match or the number of positions, if there is no match.
+ */
+std::size_t TSearchMatcher::FindLastHorspool(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept
+{
+    const auto first_byte = this->pattern_[0];
+    auto end = positions;
+    while (end > start)
+    {
+        // Compare the first byte first, then the rest of the pattern
+        const auto position = end - 1;
+        const auto value = data[position];
+        const auto first_matches = ((value == first_byte) || ((this->ignore_case_) && (TSearchMatcher::Fold(value) == first_byte)));
+        if ((first_matches) && (this->Matches(&data[position]))) return position;
+
+        // Align the previous occurrence of the byte within the pattern
+        const auto shift = this->reverse_shift_[value];
+        if (shift >= end - start) break;
+        end -= shift;
+    }
+    return positions;
+}
+
+#if defined(HE_HAS_SSE2)
+/**
+ * Finds the first match by comparing the anchors at 16 positions at a time (SSE2), verifying each candidate.
+ * @param data The data.
+ * @param start The first position to check.
+ * @param positions The number of positions.
+ * @return The position of the first match or the number of positions, if there is no match.
+ */
+std::size_t TSearchMatcher::FindSse2(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept
+{
+    const auto anchor1 = _mm_set1_epi8(static_cast<char>(this->pattern_[this->anchor1_]));
+    const auto anchor2 = _mm_set1_epi8(static_cast<char>(this->pattern_[this->anchor2_]));
+    const auto case_mask1 = _mm_set1_epi8(static_cast<char>(this->case_mask1_));
+    const auto case_mask2 = _mm_set1_epi8(static_cast<char>(this->case_mask2_));
+    auto position = start;
+
+    // Compare 16 positions at a time (the loads stay within the data, the anchors are within the pattern, letters are lowered via the case masks)
+    for (; position + 16 <= positions; position += 16)
+    {
+        const auto block1 = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[position + this->anchor1_])), case_mask1);
+        const auto block2 = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[position + this->anchor2_])), case_mask2);
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block1, anchor1), _mm_cmpeq_epi8(block2, anchor2))));
+        while (mask != 0)
+        {
+            const auto candidate = position + LowestBit(mask);
+            if (this->Matches(&data[candidate])) return candidate;
+            mask &= mask - 1;
+        }
+    }
+
+    // Check the remaining positions
+    return (this->ignore_case_) ? this->FindHorspool(data, position, positions) : this->FindScalar(data, position, positions);
+}
+
+/**
+ * Finds the last match by comparing the anchors at 16 positions at a time (SSE2) from the end, verifying each candidate.
+ * @param data The data.
+ * @param start The lowest position to check.
+ * @param positions The number of positions.
+ * @return The position of the last match or the number of positions, if there is no match.
+ */
+std::size_t TSearchMatcher::FindLastSse2(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept
+{
+    const auto anchor1 = _mm_set1_epi8(static_cast<char>(this->pattern_[this->anchor1_]));
+    const auto anchor2 = _mm_set1_epi8(static_cast<char>(this->pattern_[this->anchor2_]));
+    const auto case_mask1 = _mm_set1_epi8(static_cast<char>(this->case_mask1_));
+    const auto case_mask2 = _mm_set1_epi8(static_cast<char>(this->case_mask2_));
+    auto end = positions;
+
+    // Compare 16 positions at a time, the highest candidates first
+    for (; end >= start + 16; end -= 16)
+    {
+        const auto position = end - 16;
+        const auto block1 = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[position + this->anchor1_])), case_mask1);
+        const auto block2 = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[position + this->anchor2_])), case_mask2);
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block1, anchor1), _mm_cmpeq_epi8(block2, anchor2))));
+        while (mask != 0)
+        {
+            const auto bit = HighestBit(mask);
+            if (this->Matches(&data[position + bit])) return position + bit;
+            mask &= ~(1u << bit);
+        }
+    }
+
+    // Check the remaining positions (at the start)
+    const auto match = (this->ignore_case_) ? this->FindLastHorspool(data, start, end) : this->FindLastScalar(data, start, end);
+    return (match < end) ? match : positions;
+}
+#endif
+
+#if defined(HE_HAS_AVX2)
+/**
+ * Finds the first match by comparing the anchors at 32 positions at a time (AVX2), verifying each candidate.
+ * Must only be called if the processor supports AVX2 (see DetectPath()).
+ * @param data The data.
+ * @param start The first position to check.
+ * @param positions The number of positions.
+ * @return The position of the first match or the number of positions, if there is no match.
+ */
+HE_TARGET_AVX2 std::size_t TSearchMatcher::FindAvx2(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept
+{
+    const auto anchor1 = _mm256_set1_epi8(static_cast<char>(this->pattern_[this->anchor1_]));
+    const auto anchor2 = _mm256_set1_epi8(static_cast<char>(this->pattern_[this->anchor2_]));
+    const auto case_mask1 = _mm256_set1_epi8(static_cast<char>(this->case_mask1_));
+    const auto case_mask2 = _mm256_set1_epi8(static_cast<char>(this->case_mask2_));
+    auto position = start;
+
+    // Compare 32 positions at a time (the loads stay within the data, the anchors are within the pattern, letters are lowered via the case masks)
+    for (; position + 32 <= positions; position += 32)
+    {
+        const auto block1 = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&data[position + this->anchor1_])), case_mask1);
+        const auto block2 = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&data[position + this->anchor2_])), case_mask2);
+        auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(block1, anchor1), _mm256_cmpeq_epi8(block2, anchor2))));
+        while (mask != 0)
+        {
+            const auto candidate = position + LowestBit(mask);
+            if (this->Matches(&data[candidate])) return candidate;
+            mask &= mask - 1;
+        }
+    }
+
+    // Check the remaining positions
+    return (this->ignore_case_) ? this->FindHorspool(data, position, positions) : this->FindScalar(data, position, positions);
+}
+
+/**
+ * Finds the last match by comparing the anchors at 32 positions at a time (AVX2) from the end, verifying each candidate.
+ * Must only be called if the processor supports AVX2 (see DetectPath()).
+ * @param data The data.
+ * @param start The lowest position to check.
+ * @param positions The number of positions.
+ * @return The position of the last match or the number of positions, if there is no match.
+ */
+HE_TARGET_AVX2 std::size_t TSearchMatcher::FindLastAvx2(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept
+{
+    const auto anchor1 = _mm256_set1_epi8(static_cast<char>(this->pattern_[this->anchor1_]));
+    const auto anchor2 = _mm256_set1_epi8(static_cast<char>(this->pattern_[this->anchor2_]));
+    const auto case_mask1 = _mm256_set1_epi8(static_cast<char>(this->case_mask1_));
+    const auto case_mask2 = _mm256_set1_epi8(static_cast<char>(this->case_mask2_));
+    auto end = positions;
+
+    // Compare 32 positions at a time, the highest candidates first
+    for (; end >= start + 32; end -= 32)
+    {
+        const auto position = end - 32;
+        const auto block1 = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&data[position + this->anchor1_])), case_mask1);
+        const auto block2 = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&data[position + this->anchor2_])), case_mask2);
+        auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(block1, anchor1), _mm256_cmpeq_epi8(block2, anchor2))));
+        while (mask != 0)
+        {
+            const auto bit = HighestBit(mask);
+            if (this->Matches(&data[position + bit])) return position + bit;
+            mask &= ~(1u << bit);
+        }
+    }
+
+    // Check the remaining positions (at the start)
+    const auto match = (this->ignore_case_) ? this->FindLastHorspool(data, start, end) : this->FindLastScalar(data, start, end);
+    return (match < end) ? match : positions;
+}
+#endif
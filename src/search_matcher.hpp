@@ -0,0 +1,69 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#ifndef HEDIT_SRC_SEARCH_MATCHER_HPP_
+
+    // Header included
+    #define HEDIT_SRC_SEARCH_MATCHER_HPP_
+
+    // The pattern length from which the Horspool algorithm is used
+    constexpr std::size_t HE_SEARCH_HORSPOOL_LENGTH = 16;  //!< The minimum length of a search string that is searched via Horspool instead of memchr() (if no SIMD instructions are available, see the benchmark in the tests).
+
+    // The implementations of the matcher
+    enum class TSearchMatcherPath : int32_t {
+        SCALAR,     //!< The rarest byte is found via memchr(), each hit is verified.
+        SSE2,       //!< The two rarest bytes are compared 16 positions at a time (SSE2), each hit is verified.
+        AVX2,       //!< The two rarest bytes are compared 32 positions at a time (AVX2), each hit is verified.
+        HORSPOOL    //!< The Boyer-Moore-Horspool algorithm (skips up to the pattern length per step).
+    };
+
+    /**
+     * @brief The matcher that finds an exact byte string in a block of memory.
+     * @details The two rarest bytes of the pattern (estimated via the typical frequency of the bytes in text and binary data)
+     * are used as anchors: the positions where both anchors match are found via SIMD compares (16 or 32 positions per step)
+     * and only these candidates are compared completely. AVX2 is selected at runtime if the processor supports it, SSE2 is
+     * available on all x86-64 processors. Without SIMD instructions, the rarest byte is found via memchr() and patterns
+     * of HE_SEARCH_HORSPOOL_LENGTH bytes and more are searched via Horspool.
+     * Case insensitive patterns match the letters A-Z regardless of case, all other bytes (including binary zeros and
+     * the bytes above 0x7F) must match exactly: the pattern is stored in lower case, the anchors are lowered via a mask
+     * (0x20 for letters) before the SIMD compare and the scalar search uses Horspool with the shifts of both cases.
+     * Backward searches (FindLast()) scan the blocks from their end with the same anchors (the highest candidates of each
+     * 16 or 32 positions first) or with a reverse Horspool, which aligns the first byte of the pattern.
+     */
+    class TSearchMatcher
+    {
+    private:
+        std::vector<unsigned char> pattern_;    //!< The pattern (the search string).
+        std::size_t anchor1_ = 0;               //!< The offset of the rarest byte within the pattern.
+        std::size_t anchor2_ = 0;               //!< The offset of the second rarest byte within the pattern (equals anchor1_ for a single byte).
+        std::size_t shift_[256] = {};           //!< The Horspool shifts by the byte that is aligned with the last byte of the pattern.
+        std::size_t reverse_shift_[256] = {};   //!< The reverse Horspool shifts by the byte that is aligned with the first byte of the pattern.
+        bool ignore_case_ = false;              //!< Letters (A-Z) match regardless of case (the pattern is stored in lower case).
+        unsigned char case_mask1_ = 0;          //!< The mask that lowers the first anchor before comparing it (0x20 for a letter, if the case is ignored).
+        unsigned char case_mask2_ = 0;          //!< The mask that lowers the second anchor before comparing it (0x20 for a letter, if the case is ignored).
+        TSearchMatcherPath path_ = TSearchMatcherPath::SCALAR;  //!< The implementation that is used (see Prepare()).
+    private:
+        static int32_t ByteFrequency(unsigned char value) noexcept;
+        static unsigned char Fold(unsigned char value) noexcept;
+        std::size_t FindScalar(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept;
+        std::size_t FindHorspool(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept;
+        std::size_t FindLastScalar(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept;
+        std::size_t FindLastHorspool(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept;
+        #if defined(HE_HAS_SSE2)
+        std::size_t FindSse2(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept;
+        std::size_t FindLastSse2(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept;
+        #endif
+        #if defined(HE_HAS_AVX2)
+        HE_TARGET_AVX2 std::size_t FindAvx2(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept;
+        HE_TARGET_AVX2 std::size_t FindLastAvx2(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept;
+        #endif
+    public:
+        bool Prepare(const unsigned char* pattern, std::size_t length, bool ignore_case, TSearchMatcherPath path = TSearchMatcher::DetectPath()) noexcept;
+        std::size_t Find(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept;
+        std::size_t FindLast(const unsigned char* data, std::size_t start, std::size_t positions) const noexcept;
+        bool Matches(const unsigned char* data) const noexcept;
+        std::size_t Length() const noexcept;
+        TSearchMatcherPath Path() const noexcept;
+        static TSearchMatcherPath DetectPath() noexcept;
+    };
+
+#endif  // HEDIT_SRC_SEARCH_MATCHER_HPP_
@@ -0,0 +1,182 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers.hpp"
+
+/**
+ * Creates a pool that searches with the specified engine. The workers are started when the first range spans multiple blocks.
+ * @param engine The prepared search engine, which is used by the calling thread and copied for each worker.
+ * @param threads The number of threads that search in parallel, including the calling thread (0 for one thread per processor).
+ */
+TSearchPool::TSearchPool(TSearchEngine& engine, int32_t threads) noexcept
+    : engine_(engine), threads_(threads)
+{
+    if (this->threads_ <= 0) this->threads_ = static_cast<int32_t>(std::thread::hardware_concurrency());
+    this->threads_ = hedit_min(hedit_max(this->threads_, 1), HE_SEARCH_MAX_THREADS);
+}
+
+/**
+ * Destructor, stops the workers (a block that is being searched is completed first).
+ */
+TSearchPool::~TSearchPool()
+{
+    // Tell the workers to terminate
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->stop_ = true;
+    }
+    this->signal_.notify_all();
+
+    // Wait for the workers
+    for (auto& worker : this->worker_) worker.join();
+}
+
+/**
+ * Searches the specified positions of the files in blocks of HE_SEARCH_BLOCK_SIZE positions, in parallel.
+ * The result is the same as if the blocks were searched one after the other (see TSearchEngine::Search()).
+ * @param position The first position to check (the highest position, if searching backward).
+ * @param count The number of positions to check (at most Capacity()).
+ * @param direction The search direction (see TSearchDirection).
+ * @param match Receives the position of the first match in the search direction.
+ * @return true if a match was found, false otherwise (TSearchMode::COUNT counts the matches, see Counter()).
+ */
+bool TSearchPool::Search(int64_t position, int64_t count, TSearchDirection direction, int64_t& match) noexcept
+{
+    // Ensure a valid range
+    if ((count <= 0) || (count > this->Capacity())) return false;
+    const auto blocks = static_cast<int32_t>((count + HE_SEARCH_BLOCK_SIZE - 1) / HE_SEARCH_BLOCK_SIZE);
+    if (blocks > 1) this->Start();
+
+    // Publish the job
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->job_++;
+        this->position_ = position;
+        this->count_ = count;
+        this->direction_ = direction;
+        this->blocks_ = blocks;
+        this->next_block_ = 0;
+        this->pending_ = blocks;
+        this->best_block_ = blocks;
+    }
+    if (!this->worker_.empty()) this->signal_.notify_all();
+
+    // Search the blocks on the calling thread as well, then wait for the blocks of the workers
+    this->Work(this->engine_);
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    this->signal_.wait(lock, [this] { return (this->pending_ == 0); });
+    if (this->best_block_ >= this->blocks_) return false;
+    match = this->best_match_;
+    return true;
+}
+
+/**
+ * Returns the maximum number of positions that are searched per call of Search() (one block per thread).
+ * @return The maximum number of positions per call of Search().
+ */
+int64_t TSearchPool::Capacity() const noexcept
+{
+    return HE_SEARCH_BLOCK_SIZE * this->threads_;
+}
+
+/**
+ * Returns the number of matches counted so far by all threads (TSearchMode::COUNT).
+ * @return The number of matches.
+ */
+int64_t TSearchPool::Counter() const noexcept
+{
+    auto counter = this->engine_.Counter();
+    for (const auto& engine : this->worker_engine_) counter += engine.Counter();
+    return counter;
+}
+
+/**
+ * Starts the workers (once). If not all workers can be started, the blocks are searched by fewer threads.
+ */
+void TSearchPool::Start() noexcept
+{
+    if (this->started_) return;
+    this->started_ = true;
+
+    // Copy the engine for each worker (the engines must not move while the workers are running)
+    const auto workers = static_cast<std::size_t>(this->threads_ - 1);
+    try
+    {
+        this->worker_engine_.reserve(workers);
+        this->worker_.reserve(workers);
+        while (this->worker_engine_.size() < workers) this->worker_engine_.push_back(this->engine_);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return;
+    }
+
+    // Start the workers
+    for (std::size_t i = 0; i < workers; i++)
+    {
+        try
+        {
+            this->worker_.emplace_back(&TSearchPool::Run, this, i);
+        }
+        catch (const std::exception&)
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * The main function of a worker: searches the blocks of each new job.
+ * @param index The index of the worker (and of its search engine).
+ */
+void TSearchPool::Run(std::size_t index) noexcept
+{
+    uint64_t job = 0;
+    while (true)
+    {
+        // Wait for a new job
+        {
+            std::unique_lock<std::mutex> lock(this->mutex_);
+            this->signal_.wait(lock, [this, job] { return ((this->stop_) || (this->job_ != job)); });
+            if (this->stop_) break;
+            job = this->job_;
+        }
+
+        // Search the blocks of the job
+        this->Work(this->worker_engine_[index]);
+    }
+}
+
+/**
+ * Searches the blocks of the current job with the specified engine, until all blocks are taken.
+ * Blocks behind the first block with a match (in search order) are skipped.
+ * @param engine The search engine of the thread.
+ */
+void TSearchPool::Work(TSearchEngine& engine) noexcept
+{
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    while (this->next_block_ < this->blocks_)
+    {
+        // Take the next block, unless a match was already found in front of it
+        const auto block = this->next_block_++;
+        auto found = false;
+        int64_t match = 0;
+        if (block < this->best_block_)
+        {
+            const auto offset = static_cast<int64_t>(block) * HE_SEARCH_BLOCK_SIZE;
+            const auto position = (this->direction_ == TSearchDirection::BACKWARD) ? this->position_ - offset : this->position_ + offset;
+            const auto count = hedit_min(HE_SEARCH_BLOCK_SIZE, this->count_ - offset);
+            const auto direction = this->direction_;
+            lock.unlock();
+            found = engine.Search(position, count, direction, match);
+            lock.lock();
+        }
+
+        // Keep the match of the first block in search order
+        if ((found) && (block < this->best_block_))
+        {
+            this->best_block_ = block;
+            this->best_match_ = match;
+        }
+        if (--this->pending_ == 0) this->signal_.notify_all();
+    }
+}
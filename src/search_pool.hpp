@@ -0,0 +1,57 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#ifndef HEDIT_SRC_SEARCH_POOL_HPP_
+
+    // Header included
+    #define HEDIT_SRC_SEARCH_POOL_HPP_
+
+    // The number of threads that search in parallel
+    constexpr int32_t HE_SEARCH_MAX_THREADS = 64;  //!< The maximum number of threads that search the blocks of a batch in parallel.
+
+    /**
+     * @brief The pool of threads that search consecutive blocks of the file(s) in parallel.
+     * @details Each call of Search() splits the range into blocks of HE_SEARCH_BLOCK_SIZE positions (each block also reads
+     * the bytes that the search string covers behind its last position, so the blocks overlap by the length of the search
+     * string). The blocks are taken in search order by the workers and by the calling thread, each with its own copy of
+     * the search engine (the files are read via TFile::PRead(), which is thread-safe and reads the blocks of the threads
+     * without holding the lock of the file, so that the reads are not serialized). The match of the first block in
+     * search order wins: blocks behind a block with a match are not searched anymore. The workers are started with the
+     * first range that spans multiple blocks, so a search that ends within the first block does not start any threads.
+     */
+    class TSearchPool
+    {
+    private:
+        TSearchEngine& engine_;                         //!< The search engine of the calling thread (the prototype of the worker engines).
+        int32_t threads_;                               //!< The number of threads that search in parallel (including the calling thread).
+        bool started_ = false;                          //!< The flag that specifies if the start of the workers was attempted.
+        std::vector<TSearchEngine> worker_engine_;      //!< The search engines of the workers (one per worker).
+        std::vector<std::thread> worker_;               //!< The worker threads.
+        std::mutex mutex_;                              //!< The lock for the current job.
+        std::condition_variable signal_;                //!< The signal for a new job and for the completion of the blocks.
+        bool stop_ = false;                             //!< The flag that tells the workers to terminate.
+        uint64_t job_ = 0;                              //!< The generation of the current job (increased by each call of Search()).
+        int64_t position_ = 0;                          //!< The first position of the job (the highest position, if searching backward).
+        int64_t count_ = 0;                             //!< The number of positions of the job.
+        TSearchDirection direction_ = TSearchDirection::FORWARD;  //!< The search direction of the job.
+        int32_t blocks_ = 0;                            //!< The number of blocks of the job.
+        int32_t next_block_ = 0;                        //!< The next block that is taken (in search order).
+        int32_t pending_ = 0;                           //!< The number of blocks that are not finished yet.
+        int32_t best_block_ = 0;                        //!< The first block (in search order) with a match (blocks_, if none).
+        int64_t best_match_ = 0;                        //!< The position of the match in the best block.
+    private:
+        void Start() noexcept;
+        void Run(std::size_t index) noexcept;
+        void Work(TSearchEngine& engine) noexcept;
+    public:
+        TSearchPool(TSearchEngine& engine, int32_t threads) noexcept;
+        TSearchPool(const TSearchPool& source) = delete;
+        TSearchPool& operator=(const TSearchPool& source) = delete;
+        TSearchPool(TSearchPool&&) = delete;
+        TSearchPool& operator=(TSearchPool&&) = delete;
+        ~TSearchPool();
+        bool Search(int64_t position, int64_t count, TSearchDirection direction, int64_t& match) noexcept;
+        int64_t Capacity() const noexcept;
+        int64_t Counter() const noexcept;
+    };
+
+#endif  // HEDIT_SRC_SEARCH_POOL_HPP_
@@ -0,0 +1,69 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers_test.hpp"
+
+TEST(TClipboard, MemoryAndFile)
+{
+    uint32_t available = 0;
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TString temp_name = TestDataFactory::GetFilesDir() + "test.tmp";
+    TFile file(file_name, true);
+
+    // Create the source file
+    std::vector<unsigned char> data(HE_FILE_SAVE_BLOCK_SIZE + 16, 0x5A);
+    memcpy(&data[HE_FILE_SAVE_BLOCK_SIZE], "0123456789ABCDEF", 16);
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(static_cast<uint32_t>(data.size()), file.Write(data.data(), static_cast<uint32_t>(data.size())));
+
+    // Small data is held in memory
+    TClipboard clipboard(temp_name, 1024);
+    ASSERT_EQ(0, clipboard.Length());
+    ASSERT_EQ(true, clipboard.Prepare(16));
+    ASSERT_EQ(16, clipboard.Store(&file, HE_FILE_SAVE_BLOCK_SIZE, 16, 0));
+    ASSERT_EQ(true, clipboard.Complete());
+    ASSERT_EQ(true, clipboard.IsInMemory());
+    auto view = clipboard.Peek(4, 100, available);
+    ASSERT_EQ(12u, available);
+    ASSERT_EQ(0, memcmp(view, "456789ABCDEF", 12));
+
+    // Small data is stored in the temp file as well (for other instances)
+    {
+        unsigned char buffer[32] = {};
+        TFile temp_file(temp_name, false);
+        ASSERT_EQ(true, temp_file.Open(TFileMode::READ));
+        ASSERT_EQ(16u, temp_file.ReadAt(buffer, 32, 0));
+        ASSERT_EQ(0, memcmp(buffer, "0123456789ABCDEF", 16));
+    }
+
+    // Data that does not fit is rejected
+    ASSERT_EQ(0, clipboard.Store(&file, 0, 1, 16));
+
+    // Large data is stored in the temp file
+    const auto length = static_cast<int64_t>(data.size()) - 2;
+    ASSERT_EQ(true, clipboard.Prepare(length));
+    ASSERT_EQ(length, clipboard.Store(&file, 2, length, 0));
+    ASSERT_EQ(true, clipboard.Complete());
+    ASSERT_EQ(false, clipboard.IsInMemory());
+    ASSERT_EQ(length, clipboard.Length());
+    view = clipboard.Peek(HE_FILE_SAVE_BLOCK_SIZE - 3, 100, available);
+    ASSERT_EQ(17u, available);
+    ASSERT_EQ(0, memcmp(view, "Z0123456789ABCDEF", 17));
+
+    // Another instance may truncate the temp file, the data behind the new end is not available any longer
+    {
+        TFile temp_file(temp_name, false);
+        ASSERT_EQ(true, temp_file.Open(TFileMode::CREATE));
+    }
+    ASSERT_EQ(nullptr, clipboard.Peek(HE_FILE_SAVE_BLOCK_SIZE - 3, 100, available));
+    ASSERT_EQ(0u, available);
+
+    // The data is dropped
+    clipboard.Clear();
+    ASSERT_EQ(0, clipboard.Length());
+    ASSERT_EQ(nullptr, clipboard.Peek(0, 1, available));
+
+    // Delete test files
+    file.Close();
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+    ASSERT_EQ(0, _unlink(temp_name.ToString())) << "Delete failed for <" << temp_name.ToString() << ">";
+}
@@ -0,0 +1,174 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers_test.hpp"
+
+TEST(TFileCache, FindAndAllocate)
+{
+    TFileCache cache(2 * HE_FILE_CACHE_PAGE_SIZE);
+
+    // Two pages fit into the cache
+    ASSERT_EQ(2u, cache.GetPageCount());
+
+    // Empty cache
+    ASSERT_EQ(nullptr, cache.Find(0));
+    ASSERT_EQ(0u, cache.GetHits());
+    ASSERT_EQ(1u, cache.GetMisses());
+
+    // Allocate two blocks
+    auto page = cache.Allocate(0);
+    ASSERT_NE(nullptr, page);
+    ASSERT_EQ(0, page->start);
+    ASSERT_EQ(0u, page->length);
+    page->length = HE_FILE_CACHE_PAGE_SIZE;
+    page = cache.Allocate(HE_FILE_CACHE_PAGE_SIZE);
+    page->length = HE_FILE_CACHE_PAGE_SIZE;
+
+    // Both are found
+    ASSERT_NE(nullptr, cache.Find(0));
+    ASSERT_NE(nullptr, cache.Find(HE_FILE_CACHE_PAGE_SIZE));
+    ASSERT_EQ(2u, cache.GetHits());
+
+    // A third block recycles the least recently used page (block 0)
+    cache.Allocate(2 * HE_FILE_CACHE_PAGE_SIZE);
+    ASSERT_EQ(nullptr, cache.Find(0));
+    ASSERT_NE(nullptr, cache.Find(HE_FILE_CACHE_PAGE_SIZE));
+    ASSERT_NE(nullptr, cache.Find(2 * HE_FILE_CACHE_PAGE_SIZE));
+
+    // Discard and invalidate
+    cache.Discard(HE_FILE_CACHE_PAGE_SIZE);
+    ASSERT_EQ(nullptr, cache.Find(HE_FILE_CACHE_PAGE_SIZE));
+    cache.Invalidate();
+    ASSERT_EQ(nullptr, cache.Find(2 * HE_FILE_CACHE_PAGE_SIZE));
+
+    // Reset the counters
+    cache.ResetStatistics();
+    ASSERT_EQ(0u, cache.GetHits());
+    ASSERT_EQ(0u, cache.GetMisses());
+
+    // At least one page is created
+    TFileCache small_cache(0);
+    ASSERT_EQ(1u, small_cache.GetPageCount());
+}
+
+TEST(TFileCache, Update)
+{
+    const unsigned char data[4] = { 0x11, 0x22, 0x33, 0x44 };
+    TFileCache cache(4 * HE_FILE_CACHE_PAGE_SIZE);
+
+    // Create a full and a short (last) page
+    auto page = cache.Allocate(0);
+    memset(page->data, 0, HE_FILE_CACHE_PAGE_SIZE);
+    page->length = HE_FILE_CACHE_PAGE_SIZE;
+    page = cache.Allocate(HE_FILE_CACHE_PAGE_SIZE);
+    memset(page->data, 0, HE_FILE_CACHE_PAGE_SIZE);
+    page->length = 16;
+
+    // A write across the page boundary patches both pages
+    cache.Update(HE_FILE_CACHE_PAGE_SIZE - 2, data, 4);
+    page = cache.Find(0);
+    ASSERT_EQ(0x11, page->data[HE_FILE_CACHE_PAGE_SIZE - 2]);
+    ASSERT_EQ(0x22, page->data[HE_FILE_CACHE_PAGE_SIZE - 1]);
+    page = cache.Find(HE_FILE_CACHE_PAGE_SIZE);
+    ASSERT_EQ(0x33, page->data[0]);
+    ASSERT_EQ(0x44, page->data[1]);
+    ASSERT_EQ(16u, page->length);
+
+    // An appending write extends the short page
+    cache.Update(HE_FILE_CACHE_PAGE_SIZE + 16, data, 4);
+    page = cache.Find(HE_FILE_CACHE_PAGE_SIZE);
+    ASSERT_EQ(20u, page->length);
+    ASSERT_EQ(0x44, page->data[19]);
+
+    // A write that leaves a gap drops the page
+    cache.Update(HE_FILE_CACHE_PAGE_SIZE + 100, data, 4);
+    ASSERT_EQ(nullptr, cache.Find(HE_FILE_CACHE_PAGE_SIZE));
+    ASSERT_NE(nullptr, cache.Find(0));
+}
+
+TEST(TFileCache, Pin)
+{
+    TFileCache cache(HE_FILE_CACHE_PAGE_SIZE);
+
+    // Pin the only page
+    auto page = cache.Allocate(0);
+    const auto data = page->data;
+    const auto pinned_page = cache.Pin(0);
+    ASSERT_EQ(-1, cache.Pin(HE_FILE_CACHE_PAGE_SIZE));
+
+    // The pinned page is not recycled, a page is added instead
+    page = cache.Allocate(HE_FILE_CACHE_PAGE_SIZE);
+    ASSERT_NE(data, page->data);
+    ASSERT_EQ(2u, cache.GetPageCount());
+    ASSERT_NE(nullptr, cache.Find(0));
+
+    // After unpinning, the least recently used page is recycled again
+    cache.Unpin(pinned_page);
+    page = cache.Allocate(2 * HE_FILE_CACHE_PAGE_SIZE);
+    ASSERT_EQ(2u, cache.GetPageCount());
+    ASSERT_EQ(nullptr, cache.Find(HE_FILE_CACHE_PAGE_SIZE));
+}
+
+TEST(TFileCache, PinDropped)
+{
+    TFileCache cache(2 * HE_FILE_CACHE_PAGE_SIZE);
+
+    // Pin a page
+    auto page = cache.Allocate(0);
+    page->length = HE_FILE_CACHE_PAGE_SIZE;
+    page->data[0] = 0xAA;
+    const auto view = page->data;
+    const auto pinned_page = cache.Pin(0);
+
+    // Discarding the block keeps the referenced data, the page is not recycled
+    cache.Discard(0);
+    ASSERT_EQ(nullptr, cache.Find(0));
+    ASSERT_EQ(0xAA, view[0]);
+    page = cache.Allocate(0);
+    ASSERT_NE(view, page->data);
+    page->length = HE_FILE_CACHE_PAGE_SIZE;
+    page = cache.Allocate(HE_FILE_CACHE_PAGE_SIZE);
+    ASSERT_NE(view, page->data);
+    ASSERT_EQ(2u, cache.GetPageCount());
+
+    // Invalidating the cache keeps the data as well, the page is released by the last unpin
+    cache.Invalidate();
+    ASSERT_EQ(0xAA, view[0]);
+    cache.Unpin(pinned_page);
+    page = cache.Allocate(0);
+    ASSERT_EQ(view, page->data);
+    ASSERT_EQ(2u, cache.GetPageCount());
+
+    // A write (e.g. by another file object that shares the cache) drops a pinned page instead of changing the referenced data
+    const unsigned char data[4] = { 0x11, 0x22, 0x33, 0x44 };
+    page->length = HE_FILE_CACHE_PAGE_SIZE;
+    const auto pinned_page2 = cache.Pin(0);
+    cache.Update(0, data, 4);
+    ASSERT_EQ(nullptr, cache.Find(0));
+    ASSERT_EQ(0xAA, view[0]);
+    cache.Unpin(pinned_page2);
+}
+
+TEST(TFileCache, Registry)
+{
+    // The same file gets the same cache, other files get other caches
+    const auto count = TFileCacheRegistry::GetCacheCount();
+    auto cache1 = TFileCacheRegistry::Acquire(1, 42, HE_FILE_CACHE_PAGE_SIZE);
+    auto cache2 = TFileCacheRegistry::Acquire(1, 42, 4 * HE_FILE_CACHE_PAGE_SIZE);
+    auto cache3 = TFileCacheRegistry::Acquire(2, 42, HE_FILE_CACHE_PAGE_SIZE);
+    ASSERT_EQ(cache1.get(), cache2.get());
+    ASSERT_NE(cache1.get(), cache3.get());
+    ASSERT_EQ(1u, cache2->GetPageCount());
+    ASSERT_EQ(count + 2, TFileCacheRegistry::GetCacheCount());
+
+    // Changes increase the version
+    const auto version = cache1->GetVersion();
+    cache1->Invalidate();
+    ASSERT_NE(version, cache2->GetVersion());
+
+    // The cache is released with the last user
+    cache1.reset();
+    ASSERT_EQ(count + 2, TFileCacheRegistry::GetCacheCount());
+    cache2.reset();
+    cache3.reset();
+    ASSERT_EQ(count, TFileCacheRegistry::GetCacheCount());
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers_test.hpp"
+
+#if defined(HE_HAS_ZLIB)
+/**
+ * Compresses the specified data as one gzip member and appends it to the specified file.
+ */
+static bool AppendGzipMember(FILE* file, const unsigned char* data, std::size_t length)
+{
+    z_stream stream = {};
+    std::vector<unsigned char> output(65536);
+    if (deflateInit2(&stream, 1, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY) != Z_OK) return false;
+    stream.next_in = const_cast<unsigned char*>(data);
+    stream.avail_in = static_cast<uInt>(length);
+    auto result = Z_OK;
+    while (result == Z_OK)
+    {
+        stream.next_out = output.data();
+        stream.avail_out = static_cast<uInt>(output.size());
+        result = deflate(&stream, Z_FINISH);
+        const auto count = output.size() - stream.avail_out;
+        if (fwrite(output.data(), 1, count, file) != count) result = Z_ERRNO;
+    }
+    deflateEnd(&stream);
+    return (result == Z_STREAM_END);
+}
+#endif
+
+TEST(TFileGzip, RandomAccess)
+{
+    #if defined(HE_HAS_ZLIB)
+    unsigned char buffer[64] = {};
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat.gz";
+    TString index_name = file_name + HE_FILE_GZIP_INDEX_SUFFIX;
+    TFile file(file_name, true);
+
+    // Create compressible data that spans several checkpoints and store it as two gzip members
+    std::vector<unsigned char> data(9 * 1048576 + 12345);
+    uint32_t seed = 1;
+    for (std::size_t i = 0; i < data.size(); i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        data[i] = static_cast<unsigned char>((i % 1000 < 500) ? (i >> 10) : (seed >> 24) & 0x0F);
+    }
+    const auto member_size = static_cast<std::size_t>(5 * 1048576 + 7);
+    const auto total = static_cast<int64_t>(data.size());
+    _unlink(index_name.ToString());
+    auto output = fopen(file_name, "wb");
+    ASSERT_NE(nullptr, output);
+    ASSERT_EQ(true, AppendGzipMember(output, data.data(), member_size));
+    ASSERT_EQ(true, AppendGzipMember(output, &data[member_size], data.size() - member_size));
+    ASSERT_EQ(0, fclose(output));
+    ASSERT_EQ(true, TFileGzip::IsCompressed(file_name));
+
+    // The decompressed content is read-only, the whole content is available once it is indexed
+    ASSERT_EQ(true, file.Open(TFileMode::DECOMPRESS));
+    ASSERT_EQ(true, file.IsCompressed());
+    ASSERT_EQ(true, file.IsReadOnly());
+    ASSERT_EQ(total, file.WaitForSize(total + 1, -1));
+    ASSERT_EQ(false, file.IsStreaming());
+
+    // Random reads (within a span, across checkpoints, across the members and at the end)
+    const int64_t positions[] = { 0, total - 64, 4194000, 1000, member_size - 32, 8388600, 2, member_size + 4194304, total - 10 };
+    for (const auto position : positions)
+    {
+        const auto count = static_cast<uint32_t>(hedit_min(static_cast<int64_t>(sizeof(buffer)), total - position));
+        ASSERT_EQ(count, file.ReadAt(buffer, sizeof(buffer), position)) << "Position " << position;
+        ASSERT_EQ(0, memcmp(buffer, &data[static_cast<std::size_t>(position)], count)) << "Position " << position;
+    }
+    file.Close();
+
+    // The index is cached, so the content is available at once when the file is opened again
+    TFile index(index_name, false);
+    ASSERT_EQ(true, index.Open(TFileMode::READ));
+    ASSERT_LT(0, index.FileSize());
+    index.Close();
+    ASSERT_EQ(true, file.Open(TFileMode::DECOMPRESS));
+    ASSERT_EQ(false, file.IsStreaming());
+    ASSERT_EQ(total, file.FileSize());
+    ASSERT_EQ(sizeof(buffer), file.ReadAt(buffer, sizeof(buffer), 6000000));
+    ASSERT_EQ(0, memcmp(buffer, &data[6000000], sizeof(buffer)));
+
+    // Without decompression, the compressed file is read
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(false, file.IsCompressed());
+    ASSERT_GT(total, file.FileSize());
+
+    // Delete test files
+    file.Close();
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+    ASSERT_EQ(0, _unlink(index_name.ToString())) << "Delete failed for <" << index_name.ToString() << ">";
+    #endif
+}
@@ -0,0 +1,44 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers_test.hpp"
+
+TEST(TFileSnapshot, BeforeFirstChange)
+{
+    unsigned char buffer[16] = {};
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TString snapshot_name = file_name + HE_FILE_SNAPSHOT_SUFFIX;
+    TFile file(file_name, true);
+    TFile check_file(snapshot_name, false);
+
+    // Create a file of more than one copy block
+    std::vector<unsigned char> data(static_cast<std::size_t>(HE_FILE_SNAPSHOT_BLOCK_SIZE + 16), 0x5A);
+    memcpy(&data[static_cast<std::size_t>(HE_FILE_SNAPSHOT_BLOCK_SIZE)], "0123456789ABCDEF", 16);
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(static_cast<uint32_t>(data.size()), file.Write(data.data(), static_cast<uint32_t>(data.size())));
+    ASSERT_EQ(true, file.Open(TFileMode::READWRITE));
+    ASSERT_EQ(true, file.EnableOverlay());
+    ASSERT_EQ(true, file.EnableSnapshot(snapshot_name));
+
+    // The snapshot is taken with the first change and completed before the change is saved
+    ASSERT_EQ(1u, file.WriteAt(reinterpret_cast<const unsigned char*>("x"), 1, HE_FILE_SNAPSHOT_BLOCK_SIZE + 2));
+    ASSERT_EQ(true, file.Erase(0, 4));
+    ASSERT_EQ(true, file.Save());
+    ASSERT_EQ(false, file.IsSnapshotPending());
+
+    // The snapshot holds the original data
+    ASSERT_EQ(true, check_file.Open(TFileMode::READ));
+    ASSERT_EQ(static_cast<int64_t>(data.size()), check_file.FileSize());
+    ASSERT_EQ(16u, check_file.ReadAt(buffer, 16, HE_FILE_SNAPSHOT_BLOCK_SIZE));
+    ASSERT_EQ(0, memcmp(buffer, "0123456789ABCDEF", 16));
+    check_file.Close();
+
+    // The file holds the changes
+    ASSERT_EQ(static_cast<int64_t>(data.size()) - 4, file.FileSize());
+    ASSERT_EQ(4u, file.ReadAt(buffer, 4, HE_FILE_SNAPSHOT_BLOCK_SIZE - 4));
+    ASSERT_EQ(0, memcmp(buffer, "01x3", 4));
+
+    // Delete test files
+    file.Close();
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+    ASSERT_EQ(0, _unlink(snapshot_name.ToString())) << "Delete failed for <" << snapshot_name.ToString() << ">";
+}
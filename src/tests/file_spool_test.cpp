@@ -0,0 +1,58 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers_test.hpp"
+
+TEST(TFileSpool, Pipe)
+{
+    #if !(defined(_WIN32) || defined(__WIN32__))
+    unsigned char buffer[16] = {};
+    TString file_name = TestDataFactory::GetFilesDir() + "test.fifo";
+    TFile file(file_name, true, true);
+    std::vector<unsigned char> data(200000);
+    for (std::size_t i = 0; i < data.size(); i++) data[i] = static_cast<unsigned char>(i * 7);
+
+    // Create the pipe and write the data in two parts, the second part after the first part was read
+    ASSERT_EQ(0, mkfifo(file_name, 0600));
+    std::promise<void> release;
+    std::thread writer([&file_name, &data, &release]()
+    {
+        const auto handle = open(file_name, O_WRONLY);
+        if (handle < 0) return;
+        if (write(handle, data.data(), 100000) == 100000)
+        {
+            release.get_future().wait();
+            if (write(handle, &data[100000], 100000) != 100000) data.clear();
+        }
+        close(handle);
+    });
+
+    // A stream can only be read
+    ASSERT_EQ(false, file.Open(TFileMode::READWRITE));
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(true, file.IsReadOnly());
+
+    // The first part is read while the stream is still arriving
+    ASSERT_EQ(16u, file.ReadAt(buffer, 16, 100000 - 16));
+    ASSERT_EQ(0, memcmp(buffer, &data[100000 - 16], 16));
+    ASSERT_EQ(true, file.IsStreaming());
+    ASSERT_EQ(100000, file.FileSize());
+    ASSERT_EQ(100000, file.WaitForSize(100001, 10));
+
+    // Reading the second part waits until it has arrived
+    release.set_value();
+    ASSERT_EQ(16u, file.ReadAt(buffer, 16, 200000 - 16));
+    ASSERT_EQ(0, memcmp(buffer, &data[200000 - 16], 16));
+
+    // The stream ends, the temporary file is mapped then
+    ASSERT_EQ(200000, file.WaitForSize(200001, -1));
+    ASSERT_EQ(false, file.IsStreaming());
+    ASSERT_EQ(true, file.IsMapped());
+    ASSERT_EQ(16u, file.ReadAt(buffer, 16, 0));
+    ASSERT_EQ(0, memcmp(buffer, data.data(), 16));
+    writer.join();
+
+    // Delete the pipe
+    file.Close();
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+    #endif
+}
@@ -1,240 +1,1267 @@
-// Copyright (c) 2021 Roxxorfreak
-
-#include "headers_test.hpp"
-
-TEST(TFile, Open)
-{
-    TFile file(TestDataFactory::GetFilesDir() + "test.zip", true);
-
-    // Open the test zip file for reading
-    ASSERT_EQ(true, file.Open(TFileMode::READ));
-
-    // Open non-existing file for reading
-    TString file_name = TestDataFactory::GetFilesDir() + "test2.zip";
-    file.AssignFileName(file_name);
-    ASSERT_EQ(false, file.Open(TFileMode::READ)) << "<" << file_name.ToString() << "> must be deleted prior to test run";
-
-    // Create file
-    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
-    file.Close();
-
-    // Open created file
-    ASSERT_EQ(true, file.Open(TFileMode::READWRITE));
-    file.Close();
-
-    // Delete test file
-    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
-}
-
-TEST(TFile, Read)
-{
-    unsigned char buffer[64];
-    TFile file(TestDataFactory::GetFilesDir() + "test.zip", true);
-    TFile file2(TestDataFactory::GetFilesDir() + "test.zip", false);
-
-    // Read from closed file (with and without cache)
-    ASSERT_EQ(0u, file.Read(buffer, 4));
-    ASSERT_EQ(0u, file2.Read(buffer, 4));
-
-    // Read from openend file (with and without cache)
-    // With cache
-    ASSERT_EQ(true, file.Open(TFileMode::READ));
-    ASSERT_EQ(4u, file.Read(buffer, 4));
-    ASSERT_EQ('P', buffer[0]);
-    ASSERT_EQ('K', buffer[1]);
-    ASSERT_EQ(0x03, buffer[2]);
-    ASSERT_EQ(0x04, buffer[3]);
-    // No cache
-    ASSERT_EQ(true, file2.Open(TFileMode::READ));
-    ASSERT_EQ(4u, file2.Read(buffer, 4));
-    ASSERT_EQ(4u, file2.Read(buffer, 4));
-    ASSERT_EQ(0x0A, buffer[0]);
-    ASSERT_EQ(0x00, buffer[1]);
-    ASSERT_EQ(0x00, buffer[2]);
-    ASSERT_EQ(0x00, buffer[3]);
-}
-
-TEST(TFile, ReadAt)
-{
-    unsigned char buffer[64];
-    TFile file(TestDataFactory::GetFilesDir() + "test.zip", true);
-    TFile file2(TestDataFactory::GetFilesDir() + "test.zip", false);
-
-    // Read from closed file (with and without cache)
-    ASSERT_EQ(0u, file.ReadAt(buffer, 4, 0x00004567));
-    ASSERT_EQ(0u, file2.ReadAt(buffer, 4, 0x00004567));
-
-    // Read from openend file (with and without cache)
-    // With cache
-    ASSERT_EQ(true, file.Open(TFileMode::READ));
-    ASSERT_EQ(4u, file.ReadAt(buffer, 4, 0x00004567));
-    ASSERT_EQ(0x99, buffer[0]);
-    ASSERT_EQ(0xA6, buffer[1]);
-    ASSERT_EQ(0x7B, buffer[2]);
-    ASSERT_EQ(0xF9, buffer[3]);
-    ASSERT_EQ(4u, file.ReadAt(buffer, 4, 0x00004568));
-    ASSERT_EQ(0xA6, buffer[0]);
-    ASSERT_EQ(0x7B, buffer[1]);
-    ASSERT_EQ(0xF9, buffer[2]);
-    ASSERT_EQ(0x24, buffer[3]);
-    // No cache
-    ASSERT_EQ(true, file2.Open(TFileMode::READ));
-    ASSERT_EQ(4u, file2.ReadAt(buffer, 4, 0x00004567));
-    ASSERT_EQ(0x99, buffer[0]);
-    ASSERT_EQ(0xA6, buffer[1]);
-    ASSERT_EQ(0x7B, buffer[2]);
-    ASSERT_EQ(0xF9, buffer[3]);
-
-    // Out of range
-    ASSERT_EQ(0u, file.ReadAt(buffer, 1, 0x00045678));
-    ASSERT_EQ(0u, file2.ReadAt(buffer, 1, 0x00045678));
-}
-
-TEST(TFile, Write)
-{
-    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
-    TFile file(file_name, true);
-    const unsigned char* text = reinterpret_cast<unsigned char*>("Hello");
-
-    // Write to closed file
-    ASSERT_EQ(0u, file.Write(text, 5));
-
-    // Write to read-only file
-    ASSERT_EQ(false, file.Open(TFileMode::READ)) << "<" << file_name.ToString() << "> must be deleted prior to test run";
-    ASSERT_EQ(0u, file.Write(text, 5));
-
-    // Write to r/w file
-    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
-    ASSERT_EQ(5u, file.Write(text, 5));
-    ASSERT_EQ(5, file.FileSize());
-    file.Close();
-
-    // Delete test file
-    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
-}
-
-TEST(TFile, WriteAt)
-{
-    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
-    TFile file(file_name, true);
-    const unsigned char* text = reinterpret_cast<unsigned char*>("Hello");
-
-    // Write to closed file
-    ASSERT_EQ(0u, file.WriteAt(text, 5, 42));
-
-    // Write to read-only file
-    ASSERT_EQ(false, file.Open(TFileMode::READ)) << "<" << file_name.ToString() << "> must be deleted prior to test run";
-    ASSERT_EQ(0u, file.WriteAt(text, 5, 42));
-
-    // Write to r/w file
-    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
-    ASSERT_EQ(5u, file.WriteAt(text, 5, 42));
-    ASSERT_EQ(47, file.FileSize());
-    file.Close();
-
-    // Delete test file
-    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
-}
-
-TEST(TFile, Seek)
-{
-    TFile file(TestDataFactory::GetFilesDir() + "test.zip", true);
-
-    // Seek in closed file
-    ASSERT_EQ(false, file.Seek(10));
-
-    // Seek in open file
-    ASSERT_EQ(true, file.Open(TFileMode::READ));
-    ASSERT_EQ(false, file.Seek(-10));
-    ASSERT_EQ(true, file.Seek(0));
-    ASSERT_EQ(true, file.Seek(129006));
-    ASSERT_EQ(true, file.Seek(0));
-    ASSERT_EQ(true, file.Seek(229006));
-}
-
-TEST(TFile, ReadLine)
-{
-    TFile file(TestDataFactory::GetFilesDir() + "test.txt", true);
-
-    // Read line from closed file
-    ASSERT_STREQ(nullptr, file.ReadLine().ToString());
-
-    // Read lines
-    ASSERT_EQ(true, file.Open(TFileMode::READ));
-    ASSERT_STREQ("Line 1", file.ReadLine().ToString());
-    ASSERT_STREQ("Second line", file.ReadLine().ToString());
-    ASSERT_STREQ("Last line of defense", file.ReadLine().ToString());
-    ASSERT_STREQ("end", file.ReadLine().ToString());
-    ASSERT_STREQ(nullptr, file.ReadLine().ToString());
-}
-
-TEST(TFile, IsEOF)
-{
-    unsigned char buffer[2] = {};
-    TFile file(TestDataFactory::GetFilesDir() + "test.zip", true);
-    TFile file2(TestDataFactory::GetFilesDir() + "test.zip", false);
-
-    // Closed file
-    ASSERT_EQ(true, file.IsEOF());
-    ASSERT_EQ(true, file2.IsEOF());
-
-    // Open file with caching
-    ASSERT_EQ(true, file.Open(TFileMode::READ));
-    ASSERT_EQ(false, file.IsEOF());
-    ASSERT_EQ(true, file.Seek(file.FileSize()));
-    ASSERT_EQ(true, file.IsEOF());
-    file.Close();
-
-    // Open file without caching
-    ASSERT_EQ(true, file2.Open(TFileMode::READ));
-    ASSERT_EQ(false, file2.IsEOF());
-    ASSERT_EQ(true, file2.Seek(file2.FileSize()));
-    ASSERT_EQ(0u, file2.Read(buffer, 1));
-    ASSERT_EQ(true, file2.IsEOF());
-    file2.Close();
-}
-
-TEST(TFile, IsReadOnly)
-{
-    TFile file(TestDataFactory::GetFilesDir() + "empty.dat", true);
-
-    // Closed file
-    ASSERT_EQ(false, file.IsReadOnly());
-
-    // Open read-only
-    ASSERT_EQ(true, file.Open(TFileMode::READ));
-    ASSERT_EQ(true, file.IsReadOnly());
-    file.Close();
-
-    // Open read-write
-    ASSERT_EQ(true, file.Open(TFileMode::READWRITE));
-    ASSERT_EQ(false, file.IsReadOnly());
-    file.Close();
-
-    // Open read-write
-    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
-    ASSERT_EQ(false, file.IsReadOnly());
-    file.Close();
-}
-
-TEST(TFile, FileSize)
-{
-    TFile file(TestDataFactory::GetFilesDir() + "empty.dat", true);
-
-    // Closed file
-    ASSERT_EQ(0, file.FileSize());
-
-    // Empty file
-    ASSERT_EQ(true, file.Open(TFileMode::READ));
-    ASSERT_EQ(0, file.FileSize());
-
-    // Test bitmap
-    file.AssignFileName(TestDataFactory::GetFilesDir() + "test.bmp");
-    ASSERT_EQ(true, file.Open(TFileMode::READ));
-    ASSERT_EQ(12342, file.FileSize());
-
-    // Test bitmap
-    file.AssignFileName(TestDataFactory::GetFilesDir() + "test.txt");
-    ASSERT_EQ(true, file.Open(TFileMode::READ));
-    ASSERT_EQ(48, file.FileSize());
-}
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers_test.hpp"
+
+TEST(TFile, Open)
+{
+    TFile file(TestDataFactory::GetFilesDir() + "test.zip", true);
+
+    // Open the test zip file for reading
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+
+    // Open non-existing file for reading
+    TString file_name = TestDataFactory::GetFilesDir() + "test2.zip";
+    file.AssignFileName(file_name);
+    ASSERT_EQ(false, file.Open(TFileMode::READ)) << "<" << file_name.ToString() << "> must be deleted prior to test run";
+
+    // Create file
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    file.Close();
+
+    // Open created file
+    ASSERT_EQ(true, file.Open(TFileMode::READWRITE));
+    file.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, Read)
+{
+    unsigned char buffer[64];
+    TFile file(TestDataFactory::GetFilesDir() + "test.zip", true);
+    TFile file2(TestDataFactory::GetFilesDir() + "test.zip", false);
+
+    // Read from closed file (with and without cache)
+    ASSERT_EQ(0u, file.Read(buffer, 4));
+    ASSERT_EQ(0u, file2.Read(buffer, 4));
+
+    // Read from openend file (with and without cache)
+    // With cache
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(4u, file.Read(buffer, 4));
+    ASSERT_EQ('P', buffer[0]);
+    ASSERT_EQ('K', buffer[1]);
+    ASSERT_EQ(0x03, buffer[2]);
+    ASSERT_EQ(0x04, buffer[3]);
+    // No cache
+    ASSERT_EQ(true, file2.Open(TFileMode::READ));
+    ASSERT_EQ(4u, file2.Read(buffer, 4));
+    ASSERT_EQ(4u, file2.Read(buffer, 4));
+    ASSERT_EQ(0x0A, buffer[0]);
+    ASSERT_EQ(0x00, buffer[1]);
+    ASSERT_EQ(0x00, buffer[2]);
+    ASSERT_EQ(0x00, buffer[3]);
+}
+
+TEST(TFile, ReadAt)
+{
+    unsigned char buffer[64];
+    TFile file(TestDataFactory::GetFilesDir() + "test.zip", true);
+    TFile file2(TestDataFactory::GetFilesDir() + "test.zip", false);
+
+    // Read from closed file (with and without cache)
+    ASSERT_EQ(0u, file.ReadAt(buffer, 4, 0x00004567));
+    ASSERT_EQ(0u, file2.ReadAt(buffer, 4, 0x00004567));
+
+    // Read from openend file (with and without cache)
+    // With cache
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(4u, file.ReadAt(buffer, 4, 0x00004567));
+    ASSERT_EQ(0x99, buffer[0]);
+    ASSERT_EQ(0xA6, buffer[1]);
+    ASSERT_EQ(0x7B, buffer[2]);
+    ASSERT_EQ(0xF9, buffer[3]);
+    ASSERT_EQ(4u, file.ReadAt(buffer, 4, 0x00004568));
+    ASSERT_EQ(0xA6, buffer[0]);
+    ASSERT_EQ(0x7B, buffer[1]);
+    ASSERT_EQ(0xF9, buffer[2]);
+    ASSERT_EQ(0x24, buffer[3]);
+    // No cache
+    ASSERT_EQ(true, file2.Open(TFileMode::READ));
+    ASSERT_EQ(4u, file2.ReadAt(buffer, 4, 0x00004567));
+    ASSERT_EQ(0x99, buffer[0]);
+    ASSERT_EQ(0xA6, buffer[1]);
+    ASSERT_EQ(0x7B, buffer[2]);
+    ASSERT_EQ(0xF9, buffer[3]);
+
+    // Out of range
+    ASSERT_EQ(0u, file.ReadAt(buffer, 1, 0x00045678));
+    ASSERT_EQ(0u, file2.ReadAt(buffer, 1, 0x00045678));
+}
+
+TEST(TFile, Write)
+{
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, true);
+    const unsigned char* text = reinterpret_cast<unsigned char*>("Hello");
+
+    // Write to closed file
+    ASSERT_EQ(0u, file.Write(text, 5));
+
+    // Write to read-only file
+    ASSERT_EQ(false, file.Open(TFileMode::READ)) << "<" << file_name.ToString() << "> must be deleted prior to test run";
+    ASSERT_EQ(0u, file.Write(text, 5));
+
+    // Write to r/w file
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(5u, file.Write(text, 5));
+    ASSERT_EQ(5, file.FileSize());
+    file.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, WriteAt)
+{
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, true);
+    const unsigned char* text = reinterpret_cast<unsigned char*>("Hello");
+
+    // Write to closed file
+    ASSERT_EQ(0u, file.WriteAt(text, 5, 42));
+
+    // Write to read-only file
+    ASSERT_EQ(false, file.Open(TFileMode::READ)) << "<" << file_name.ToString() << "> must be deleted prior to test run";
+    ASSERT_EQ(0u, file.WriteAt(text, 5, 42));
+
+    // Write to r/w file
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(5u, file.WriteAt(text, 5, 42));
+    ASSERT_EQ(47, file.FileSize());
+    file.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, Seek)
+{
+    TFile file(TestDataFactory::GetFilesDir() + "test.zip", true);
+
+    // Seek in closed file
+    ASSERT_EQ(false, file.Seek(10));
+
+    // Seek in open file
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(false, file.Seek(-10));
+    ASSERT_EQ(true, file.Seek(0));
+    ASSERT_EQ(true, file.Seek(129006));
+    ASSERT_EQ(true, file.Seek(0));
+    ASSERT_EQ(true, file.Seek(229006));
+}
+
+TEST(TFile, ReadLine)
+{
+    TFile file(TestDataFactory::GetFilesDir() + "test.txt", true);
+
+    // Read line from closed file
+    ASSERT_STREQ(nullptr, file.ReadLine().ToString());
+
+    // Read lines
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_STREQ("Line 1", file.ReadLine().ToString());
+    ASSERT_STREQ("Second line", file.ReadLine().ToString());
+    ASSERT_STREQ("Last line of defense", file.ReadLine().ToString());
+    ASSERT_STREQ("end", file.ReadLine().ToString());
+    ASSERT_STREQ(nullptr, file.ReadLine().ToString());
+}
+
+TEST(TFile, IsEOF)
+{
+    unsigned char buffer[2] = {};
+    TFile file(TestDataFactory::GetFilesDir() + "test.zip", true);
+    TFile file2(TestDataFactory::GetFilesDir() + "test.zip", false);
+
+    // Closed file
+    ASSERT_EQ(true, file.IsEOF());
+    ASSERT_EQ(true, file2.IsEOF());
+
+    // Open file with caching
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(false, file.IsEOF());
+    ASSERT_EQ(true, file.Seek(file.FileSize()));
+    ASSERT_EQ(true, file.IsEOF());
+    file.Close();
+
+    // Open file without caching
+    ASSERT_EQ(true, file2.Open(TFileMode::READ));
+    ASSERT_EQ(false, file2.IsEOF());
+    ASSERT_EQ(true, file2.Seek(file2.FileSize()));
+    ASSERT_EQ(0u, file2.Read(buffer, 1));
+    ASSERT_EQ(true, file2.IsEOF());
+    file2.Close();
+}
+
+TEST(TFile, IsReadOnly)
+{
+    TFile file(TestDataFactory::GetFilesDir() + "empty.dat", true);
+
+    // Closed file
+    ASSERT_EQ(false, file.IsReadOnly());
+
+    // Open read-only
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(true, file.IsReadOnly());
+    file.Close();
+
+    // Open read-write
+    ASSERT_EQ(true, file.Open(TFileMode::READWRITE));
+    ASSERT_EQ(false, file.IsReadOnly());
+    file.Close();
+
+    // Open read-write
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(false, file.IsReadOnly());
+    file.Close();
+}
+
+TEST(TFile, FileSize)
+{
+    TFile file(TestDataFactory::GetFilesDir() + "empty.dat", true);
+
+    // Closed file
+    ASSERT_EQ(0, file.FileSize());
+
+    // Empty file
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(0, file.FileSize());
+
+    // Test bitmap
+    file.AssignFileName(TestDataFactory::GetFilesDir() + "test.bmp");
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(12342, file.FileSize());
+
+    // Test bitmap
+    file.AssignFileName(TestDataFactory::GetFilesDir() + "test.txt");
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(48, file.FileSize());
+}
+
+TEST(TFile, Mapping)
+{
+    unsigned char buffer[64];
+    TFile file(TestDataFactory::GetFilesDir() + "test.zip", true, true);
+    TFile file2(TestDataFactory::GetFilesDir() + "empty.dat", true, true);
+
+    // Closed file
+    ASSERT_EQ(false, file.IsMapped());
+
+    // Regular file
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(true, file.IsMapped());
+    ASSERT_EQ(4u, file.ReadAt(buffer, 4, 0x00004567));
+    ASSERT_EQ(0x99, buffer[0]);
+    ASSERT_EQ(0xA6, buffer[1]);
+    ASSERT_EQ(0x7B, buffer[2]);
+    ASSERT_EQ(0xF9, buffer[3]);
+    ASSERT_EQ(4u, file.Read(buffer, 4));
+    ASSERT_EQ(0x24, buffer[0]);
+
+    // Read across the end of the mapping
+    ASSERT_EQ(2u, file.ReadAt(buffer, 4, file.FileSize() - 2));
+    ASSERT_EQ(0u, file.ReadAt(buffer, 1, file.FileSize()));
+    ASSERT_EQ(true, file.IsEOF());
+    file.Close();
+    ASSERT_EQ(false, file.IsMapped());
+
+    // Empty files cannot be mapped
+    ASSERT_EQ(true, file2.Open(TFileMode::READ));
+    ASSERT_EQ(false, file2.IsMapped());
+    ASSERT_EQ(0u, file2.Read(buffer, 1));
+}
+
+TEST(TFile, MappingWrite)
+{
+    unsigned char buffer[8] = {};
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, false, true);
+    const unsigned char* text = reinterpret_cast<unsigned char*>("Hello");
+
+    // Create the file (empty files are not mapped)
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(false, file.IsMapped());
+    ASSERT_EQ(5u, file.Write(text, 5));
+    file.Close();
+
+    // Re-open the file, it is mapped now
+    ASSERT_EQ(true, file.Open(TFileMode::READWRITE));
+    ASSERT_EQ(true, file.IsMapped());
+
+    // Overwrite within the mapping, the change must be visible
+    ASSERT_EQ(1u, file.WriteAt(text + 4, 1, 0));
+    ASSERT_EQ(5u, file.ReadAt(buffer, 5, 0));
+    ASSERT_EQ('o', buffer[0]);
+    ASSERT_EQ('e', buffer[1]);
+
+    // Append beyond the mapping, the mapping must be extended
+    ASSERT_EQ(5u, file.WriteAt(text, 5, 5));
+    ASSERT_EQ(10, file.FileSize());
+    ASSERT_EQ(true, file.IsMapped());
+    ASSERT_EQ(3u, file.ReadAt(buffer, 3, 7));
+    ASSERT_EQ('l', buffer[0]);
+    ASSERT_EQ('l', buffer[1]);
+    ASSERT_EQ('o', buffer[2]);
+    file.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, MappingTruncated)
+{
+    #if !(defined(_WIN32) || defined(__WIN32__))
+    unsigned char buffer[16] = {};
+    uint32_t available = 0;
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, false, true);
+    std::vector<unsigned char> data(1048576, 0x5A);
+
+    // Create and map a file of 1 MiB
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(static_cast<uint32_t>(data.size()), file.Write(data.data(), static_cast<uint32_t>(data.size())));
+    file.Close();
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(true, file.IsMapped());
+    ASSERT_EQ(16u, file.ReadAt(buffer, 16, 900000));
+
+    // Truncate the file externally, the fault on the mapped data behind the new end must be caught
+    ASSERT_EQ(0, truncate(file_name.ToString(), 4096));
+    ASSERT_EQ(0u, file.ReadAt(buffer, 16, 900000));
+    ASSERT_EQ(4096, file.FileSize());
+    ASSERT_EQ(nullptr, file.Peek(900000, 16, available));
+    ASSERT_EQ(16u, file.ReadAt(buffer, 16, 4080));
+    ASSERT_EQ(0x5A, buffer[15]);
+    ASSERT_EQ(true, file.IsMapped());
+
+    // Extend the file externally, the mapping must cover the new data once the size is refreshed
+    ASSERT_EQ(0, truncate(file_name.ToString(), 8192));
+    ASSERT_EQ(8192, file.RefreshFileSize());
+    ASSERT_EQ(16u, file.ReadAt(buffer, 16, 8176));
+    ASSERT_EQ(0x00, buffer[15]);
+    ASSERT_EQ(8192, file.FileSize());
+    file.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+    #endif
+}
+
+TEST(TFile, PageCache)
+{
+    unsigned char buffer[64];
+    unsigned char buffer2[64];
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    TFile file(TestDataFactory::GetFilesDir() + "test.zip", true, false, HE_FILE_CACHE_PAGE_SIZE);
+    TFile file2(TestDataFactory::GetFilesDir() + "test.zip", false);
+
+    // No statistics without cache
+    ASSERT_EQ(false, file2.GetCacheStatistics(hits, misses));
+
+    // Read across the page boundary (with and without cache)
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(true, file2.Open(TFileMode::READ));
+    ASSERT_EQ(false, file.IsDirect());
+    ASSERT_EQ(64u, file.ReadAt(buffer, 64, HE_FILE_CACHE_PAGE_SIZE - 32));
+    ASSERT_EQ(64u, file2.ReadAt(buffer2, 64, HE_FILE_CACHE_PAGE_SIZE - 32));
+    ASSERT_EQ(0, memcmp(buffer, buffer2, 64));
+
+    // Both pages were loaded, the single cache page holds the second one
+    ASSERT_EQ(true, file.GetCacheStatistics(hits, misses));
+    ASSERT_EQ(0u, hits);
+    ASSERT_EQ(2u, misses);
+    ASSERT_EQ(4u, file.ReadAt(buffer, 4, HE_FILE_CACHE_PAGE_SIZE));
+    ASSERT_EQ(true, file.GetCacheStatistics(hits, misses));
+    ASSERT_EQ(1u, hits);
+    ASSERT_EQ(2u, misses);
+
+    // Reads at the end of the file are short
+    ASSERT_EQ(6u, file.ReadAt(buffer, 64, 129000));
+    ASSERT_EQ(0u, file.ReadAt(buffer, 64, 129006));
+}
+
+TEST(TFile, WriteBack)
+{
+    unsigned char buffer[8] = {};
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, true);
+    TFile file2(file_name, false);
+    const unsigned char* text = reinterpret_cast<unsigned char*>("Hello");
+
+    // Create the file (appending writes are written directly)
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(5u, file.Write(text, 5));
+    ASSERT_EQ(false, file.IsDirty());
+
+    // Overwrite two adjacent bytes, the writes are pending but visible
+    ASSERT_EQ(1u, file.WriteAt(text + 4, 1, 1));
+    ASSERT_EQ(1u, file.WriteAt(text + 4, 1, 2));
+    ASSERT_EQ(true, file.IsDirty());
+    ASSERT_EQ(5u, file.ReadAt(buffer, 5, 0));
+    ASSERT_EQ(0, memcmp(buffer, "Hoolo", 5));
+
+    // The file itself is not changed yet
+    ASSERT_EQ(true, file2.Open(TFileMode::READ));
+    ASSERT_EQ(5u, file2.ReadAt(buffer, 5, 0));
+    ASSERT_EQ(0, memcmp(buffer, "Hello", 5));
+    file2.Close();
+
+    // Flush the pending data
+    ASSERT_EQ(true, file.Flush());
+    ASSERT_EQ(false, file.IsDirty());
+    ASSERT_EQ(true, file2.Open(TFileMode::READ));
+    ASSERT_EQ(5u, file2.ReadAt(buffer, 5, 0));
+    ASSERT_EQ(0, memcmp(buffer, "Hoolo", 5));
+    file2.Close();
+
+    // Pending data is written when the file is closed
+    ASSERT_EQ(1u, file.WriteAt(text, 1, 4));
+    ASSERT_EQ(true, file.IsDirty());
+    file.Close();
+    ASSERT_EQ(true, file2.Open(TFileMode::READ));
+    ASSERT_EQ(5u, file2.ReadAt(buffer, 5, 0));
+    ASSERT_EQ(0, memcmp(buffer, "HoolH", 5));
+    file2.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, CachedFileSize)
+{
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, true);
+    TFile file2(file_name, false);
+    const unsigned char* text = reinterpret_cast<unsigned char*>("Hello");
+
+    // Closed files have no size
+    ASSERT_EQ(0, file.FileSize());
+
+    // The size is updated by extending writes
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(0, file.FileSize());
+    ASSERT_EQ(5u, file.Write(text, 5));
+    ASSERT_EQ(5, file.FileSize());
+    ASSERT_EQ(5u, file.WriteAt(text, 5, 8));
+    ASSERT_EQ(13, file.FileSize());
+    ASSERT_EQ(1u, file.WriteAt(text, 1, 0));
+    ASSERT_EQ(13, file.FileSize());
+
+    // External changes are detected after a refresh
+    ASSERT_EQ(true, file2.Open(TFileMode::READWRITE));
+    ASSERT_EQ(13, file2.FileSize());
+    ASSERT_EQ(5u, file2.WriteAt(text, 5, 13));
+    file2.Close();
+    ASSERT_EQ(13, file.FileSize());
+    ASSERT_EQ(18, file.RefreshFileSize());
+    file.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, Peek)
+{
+    uint32_t available = 0;
+    TFile file(TestDataFactory::GetFilesDir() + "test.zip", true);
+    TFile file2(TestDataFactory::GetFilesDir() + "test.zip", false);
+    TFile file3(TestDataFactory::GetFilesDir() + "test.zip", false, true);
+
+    // Peek into closed file
+    ASSERT_EQ(nullptr, file.Peek(0, 4, available));
+    ASSERT_EQ(0u, available);
+
+    // Peek with cache, without cache and into the mapping
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(true, file2.Open(TFileMode::READ));
+    ASSERT_EQ(true, file3.Open(TFileMode::READ));
+    for (auto test_file : { &file, &file2, &file3 })
+    {
+        auto view = test_file->Peek(0x00004567, 4, available);
+        ASSERT_EQ(4u, available);
+        ASSERT_EQ(0x99, view[0]);
+        ASSERT_EQ(0xA6, view[1]);
+        ASSERT_EQ(0x7B, view[2]);
+        ASSERT_EQ(0xF9, view[3]);
+
+        // Across the page boundary
+        unsigned char buffer[64];
+        ASSERT_EQ(64u, file2.ReadAt(buffer, 64, HE_FILE_CACHE_PAGE_SIZE - 32));
+        view = test_file->Peek(HE_FILE_CACHE_PAGE_SIZE - 32, 64, available);
+        ASSERT_EQ(64u, available);
+        ASSERT_EQ(0, memcmp(buffer, view, 64));
+
+        // At the end of the file
+        view = test_file->Peek(129000, 64, available);
+        ASSERT_NE(nullptr, view);
+        ASSERT_EQ(6u, available);
+        ASSERT_EQ(nullptr, test_file->Peek(129006, 64, available));
+        ASSERT_EQ(0u, available);
+    }
+}
+
+TEST(TFile, PeekRemapped)
+{
+    uint32_t available = 0;
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    std::vector<unsigned char> data(1048576, 0x5A);
+
+    // Create a file of 1 MiB
+    {
+        TFile file(file_name, false);
+        ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+        ASSERT_EQ(static_cast<uint32_t>(data.size()), file.Write(data.data(), static_cast<uint32_t>(data.size())));
+    }
+
+    // Open the file twice with a shared cache, the first file is mapped
+    TFile file(file_name, true, true);
+    TFile file2(file_name, true);
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(true, file2.Open(TFileMode::READWRITE));
+    ASSERT_EQ(true, file.IsMapped());
+    const auto view = file.Peek(900000, 16, available);
+    ASSERT_EQ(16u, available);
+
+    // Shrink the file via the second file and read the first file (which maps it again), the view must stay valid
+    unsigned char buffer[16] = {};
+    ASSERT_EQ(true, file2.EnableOverlay());
+    ASSERT_EQ(true, file2.Erase(4096, static_cast<int64_t>(data.size()) - 4096));
+    ASSERT_EQ(true, file2.Save());
+    ASSERT_EQ(16u, file.PRead(buffer, 16, 4080));
+    ASSERT_EQ(true, file.IsMapped());
+    ASSERT_EQ(0x5A, view[0]);
+    ASSERT_EQ(0x5A, view[15]);
+    file.Close();
+    file2.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, PeekPendingWrites)
+{
+    uint32_t available = 0;
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, true);
+    const unsigned char* text = reinterpret_cast<unsigned char*>("Hello");
+
+    // Create the file
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(5u, file.Write(text, 5));
+
+    // The view contains the pending write
+    ASSERT_EQ(1u, file.WriteAt(text + 4, 1, 0));
+    ASSERT_EQ(true, file.IsDirty());
+    auto view = file.Peek(0, 5, available);
+    ASSERT_EQ(5u, available);
+    ASSERT_EQ(0, memcmp(view, "oello", 5));
+    file.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, PositionalReadWrite)
+{
+    unsigned char buffer[8] = {};
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, true);
+    const unsigned char* text = reinterpret_cast<unsigned char*>("Hello");
+
+    // Create the file
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(5u, file.PWrite(text, 5, 0));
+    ASSERT_EQ(5, file.FileSize());
+
+    // Positional reads and writes do not move the file cursor
+    ASSERT_EQ(true, file.Seek(1));
+    ASSERT_EQ(1u, file.PWrite(text + 4, 1, 0));
+    ASSERT_EQ(2u, file.PRead(buffer, 2, 0));
+    ASSERT_EQ('o', buffer[0]);
+    ASSERT_EQ('e', buffer[1]);
+    ASSERT_EQ(1u, file.Read(buffer, 1));
+    ASSERT_EQ('e', buffer[0]);
+
+    // Reads beyond the end of the file
+    ASSERT_EQ(1u, file.PRead(buffer, 8, 4));
+    ASSERT_EQ(0u, file.PRead(buffer, 8, 5));
+    ASSERT_EQ(0u, file.PRead(buffer, 8, -1));
+    file.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, ConcurrentReadPeek)
+{
+    uint32_t available = 0;
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, true, false, 4 * HE_FILE_CACHE_PAGE_SIZE);
+    std::vector<unsigned char> content(16 * HE_FILE_CACHE_PAGE_SIZE, 0);
+
+    // Create a file that is larger than the cache, each page consists of one repeated byte value
+    for (std::size_t i = 0; i < content.size(); i++) content[i] = static_cast<unsigned char>(i / HE_FILE_CACHE_PAGE_SIZE);
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(static_cast<uint32_t>(content.size()), file.PWrite(content.data(), static_cast<uint32_t>(content.size()), 0));
+    ASSERT_EQ(true, file.Flush());
+
+    // Refer to the first page
+    const auto view = file.Peek(16, 16, available);
+    ASSERT_EQ(16u, available);
+
+    // Another thread reads the whole file in small blocks (which recycles the cache pages), the view must stay valid
+    std::atomic<int32_t> errors(0);
+    std::thread reader([&file, &content, &errors]() {
+        unsigned char buffer[256];
+        for (std::size_t position = 0; position < content.size(); position += sizeof(buffer))
+        {
+            if (file.PRead(buffer, sizeof(buffer), static_cast<int64_t>(position)) != sizeof(buffer)) errors++;
+            if (memcmp(buffer, &content[position], sizeof(buffer)) != 0) errors++;
+        }
+    });
+    reader.join();
+    ASSERT_EQ(0, errors);
+    for (uint32_t i = 0; i < available; i++) ASSERT_EQ(0x00, view[i]);
+    file.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, ConcurrentReadWrite)
+{
+    constexpr uint32_t record_size = 16;
+    constexpr uint32_t record_count = 32768;
+    constexpr int32_t reader_count = 8;
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, true, false, 4 * HE_FILE_CACHE_PAGE_SIZE);
+    std::vector<unsigned char> content(record_size * record_count, 0);
+    std::atomic<bool> writing(true);
+    std::atomic<int32_t> errors(0);
+
+    // Create a file of 512 KiB (more than the cache can hold), each record consists of one repeated byte value
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(static_cast<uint32_t>(content.size()), file.PWrite(content.data(), static_cast<uint32_t>(content.size()), 0));
+
+    // The readers read random ranges and check that no record is torn
+    std::vector<std::thread> readers;
+    for (int32_t reader = 0; reader < reader_count; reader++)
+    {
+        readers.emplace_back([&file, &writing, &errors, reader]() {
+            unsigned char buffer[4 * record_size];
+            uint32_t seed = static_cast<uint32_t>(reader) + 1;
+            while (writing)
+            {
+                seed = (seed * 1103515245) + 12345;
+                const auto record = (seed >> 8) % (record_count - 4);
+                if (file.PRead(buffer, sizeof(buffer), static_cast<int64_t>(record) * record_size) != sizeof(buffer)) errors++;
+                for (uint32_t i = 0; i < sizeof(buffer); i++)
+                {
+                    if (buffer[i] != buffer[(i / record_size) * record_size]) errors++;
+                }
+            }
+        });
+    }
+
+    // The writer changes whole records (in this thread) while the readers run
+    uint32_t seed = 42;
+    for (int32_t i = 0; i < 20000; i++)
+    {
+        unsigned char record_data[record_size];
+        seed = (seed * 1103515245) + 12345;
+        const auto record = (seed >> 8) % record_count;
+        memset(record_data, static_cast<int>(seed >> 24), record_size);
+        memcpy(&content[record * record_size], record_data, record_size);
+        ASSERT_EQ(record_size, file.PWrite(record_data, record_size, static_cast<int64_t>(record) * record_size));
+    }
+
+    // Stop the readers
+    writing = false;
+    for (auto& reader : readers) reader.join();
+    ASSERT_EQ(0, errors);
+
+    // Check the file content
+    file.Close();
+    TFile file2(file_name, false);
+    std::vector<unsigned char> result(content.size(), 0);
+    ASSERT_EQ(true, file2.Open(TFileMode::READ));
+    ASSERT_EQ(static_cast<uint32_t>(result.size()), file2.ReadAt(result.data(), static_cast<uint32_t>(result.size()), 0));
+    ASSERT_EQ(0, memcmp(content.data(), result.data(), content.size()));
+    file2.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, ReadAhead)
+{
+    constexpr uint32_t page_count = 40;
+    constexpr uint32_t chunk_size = 4096;
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, true);
+    std::vector<unsigned char> content(page_count * HE_FILE_CACHE_PAGE_SIZE, 0);
+    unsigned char buffer[chunk_size];
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+
+    // Create a file that is larger than the cache (1 MiB)
+    for (std::size_t i = 0; i < content.size(); i++) content[i] = static_cast<unsigned char>((i * 7) + (i >> 16));
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(static_cast<uint32_t>(content.size()), file.PWrite(content.data(), static_cast<uint32_t>(content.size()), 0));
+    ASSERT_EQ(true, file.Open(TFileMode::READWRITE));
+
+    // Scan forward, only the pages before the scan is detected are loaded by the scan itself
+    for (uint32_t position = 0; position < content.size(); position += chunk_size)
+    {
+        ASSERT_EQ(chunk_size, file.PRead(buffer, chunk_size, position));
+        ASSERT_EQ(0, memcmp(buffer, &content[position], chunk_size)) << "Forward scan differs at " << position;
+    }
+    ASSERT_EQ(true, file.GetCacheStatistics(hits, misses));
+    #if !(defined(_WIN32) || defined(__WIN32__))
+    ASSERT_LE(misses, static_cast<uint64_t>(HE_FILE_READ_AHEAD_TRIGGER + 1));
+    ASSERT_LT(0u, file.GetReadAheadPages());
+    #endif
+
+    // Scan backward, writing while scanning (the pages that were read ahead must not hide the writes)
+    for (auto position = static_cast<int64_t>(content.size()) - chunk_size; position >= 0; position -= chunk_size)
+    {
+        if ((position % (3 * HE_FILE_CACHE_PAGE_SIZE)) == 0)
+        {
+            const auto write_position = hedit_max(position - static_cast<int64_t>(HE_FILE_CACHE_PAGE_SIZE), 0);
+            content[write_position] ^= 0xFF;
+            ASSERT_EQ(1u, file.PWrite(&content[write_position], 1, write_position));
+            ASSERT_EQ(true, file.Flush());
+        }
+        ASSERT_EQ(chunk_size, file.PRead(buffer, chunk_size, position));
+        ASSERT_EQ(0, memcmp(buffer, &content[position], chunk_size)) << "Backward scan differs at " << position;
+    }
+    file.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, Holes)
+{
+    constexpr int64_t hole_end = 1048576;
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, true);
+    std::vector<unsigned char> data(4096, 0xAA);
+    unsigned char buffer[16] = {};
+    int64_t extent_start = 0;
+    int64_t extent_end = 0;
+
+    // Create a sparse file (data, hole, data)
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(4096u, file.PWrite(data.data(), 4096, 0));
+    ASSERT_EQ(4096u, file.PWrite(data.data(), 4096, hole_end));
+    ASSERT_EQ(hole_end + 4096, file.FileSize());
+
+    // The hole reads as zeros
+    ASSERT_EQ(16u, file.PRead(buffer, 16, 8192));
+    ASSERT_EQ(0, buffer[0] | buffer[15]);
+
+    // Positions behind the end of the file have no extent
+    ASSERT_EQ(false, file.GetExtent(hole_end + 4096, extent_start, extent_end));
+    ASSERT_EQ(extent_start, extent_end);
+
+    // Stop here, if the file system does not support holes
+    auto holes = file.GetHoleMap();
+    if (holes.empty()) return;
+
+    // The hole and the data extents
+    ASSERT_EQ(1u, holes.size());
+    ASSERT_EQ(4096, holes[0].start);
+    ASSERT_EQ(hole_end, holes[0].end);
+    ASSERT_EQ(false, file.GetExtent(100, extent_start, extent_end));
+    ASSERT_EQ(0, extent_start);
+    ASSERT_EQ(4096, extent_end);
+    ASSERT_EQ(true, file.GetExtent(8192, extent_start, extent_end));
+    ASSERT_EQ(4096, extent_start);
+    ASSERT_EQ(hole_end, extent_end);
+    ASSERT_EQ(false, file.GetExtent(hole_end, extent_start, extent_end));
+    ASSERT_EQ(hole_end, extent_start);
+    ASSERT_EQ(hole_end + 4096, extent_end);
+
+    // Pending writes are data
+    ASSERT_EQ(1u, file.WriteAt(data.data(), 1, 65536));
+    ASSERT_EQ(true, file.IsDirty());
+    ASSERT_EQ(true, file.GetExtent(8192, extent_start, extent_end));
+    ASSERT_EQ(65536, extent_end);
+    ASSERT_EQ(false, file.GetExtent(65536, extent_start, extent_end));
+    ASSERT_EQ(true, file.GetExtent(70000, extent_start, extent_end));
+    ASSERT_EQ(65537, extent_start);
+
+    // Writing into the hole splits it
+    ASSERT_EQ(true, file.Flush());
+    holes = file.GetHoleMap();
+    ASSERT_EQ(2u, holes.size());
+    ASSERT_LE(holes[0].end, 65536);
+    ASSERT_GT(holes[1].start, 65536);
+    ASSERT_EQ(hole_end, holes[1].end);
+    file.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, SharedCache)
+{
+    unsigned char buffer[8] = {};
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, true);
+    TFile file2(file_name, true);
+    const unsigned char* text = reinterpret_cast<unsigned char*>("Hello");
+
+    // Create the file and open it a second time
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(5u, file.Write(text, 5));
+    ASSERT_EQ(true, file2.Open(TFileMode::READWRITE));
+
+    // The page that is loaded by the first file is found by the second file
+    ASSERT_EQ(5u, file.ReadAt(buffer, 5, 0));
+    ASSERT_EQ(5u, file2.ReadAt(buffer, 5, 0));
+    ASSERT_EQ(true, file2.GetCacheStatistics(hits, misses));
+    ASSERT_EQ(1u, hits);
+    ASSERT_EQ(1u, misses);
+
+    // Writes to a shared file are not pending, they are visible to the other file at once
+    const auto version = file2.GetVersion();
+    ASSERT_EQ(1u, file.WriteAt(text + 4, 1, 1));
+    ASSERT_EQ(false, file.IsDirty());
+    ASSERT_NE(version, file2.GetVersion());
+    ASSERT_EQ(5u, file2.ReadAt(buffer, 5, 0));
+    ASSERT_EQ(0, memcmp(buffer, "Hollo", 5));
+
+    // Extending the file is detected by the other file
+    ASSERT_EQ(2u, file2.WriteAt(text, 2, 5));
+    ASSERT_EQ(7, file.FileSize());
+    ASSERT_EQ(7u, file.ReadAt(buffer, 8, 0));
+    ASSERT_EQ(0, memcmp(buffer, "HolloHe", 7));
+
+    // A closed file does not share the cache any longer, writes are pending again
+    file2.Close();
+    ASSERT_EQ(1u, file.WriteAt(text, 1, 1));
+    ASSERT_EQ(true, file.IsDirty());
+    file.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, SharedCacheMapping)
+{
+    unsigned char buffer[16] = {};
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    std::vector<unsigned char> data(1048576, 0x5A);
+
+    // Create a file of 1 MiB
+    {
+        TFile file(file_name, false);
+        ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+        ASSERT_EQ(static_cast<uint32_t>(data.size()), file.Write(data.data(), static_cast<uint32_t>(data.size())));
+    }
+
+    // Open the file twice with a shared cache, the first file is mapped
+    TFile file(file_name, true, true);
+    TFile file2(file_name, true);
+    ASSERT_EQ(true, file.Open(TFileMode::READ));
+    ASSERT_EQ(true, file2.Open(TFileMode::READWRITE));
+    ASSERT_EQ(true, file.IsMapped());
+    ASSERT_EQ(16u, file.ReadAt(buffer, 16, 900000));
+
+    // Shrink the file via the second file, the first file must not read behind the new end
+    ASSERT_EQ(true, file2.EnableOverlay());
+    ASSERT_EQ(true, file2.Erase(4096, static_cast<int64_t>(data.size()) - 4096));
+    ASSERT_EQ(true, file2.Save());
+    ASSERT_EQ(4096, file.FileSize());
+    ASSERT_EQ(0u, file.ReadAt(buffer, 16, 900000));
+    ASSERT_EQ(16u, file.ReadAt(buffer, 16, 4080));
+    ASSERT_EQ(0x5A, buffer[15]);
+    file.Close();
+    file2.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, DisableOverlay)
+{
+    unsigned char buffer[8] = {};
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, true);
+    const unsigned char* text = reinterpret_cast<unsigned char*>("Hello");
+
+    // Create the file, the insert enables the overlay
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(5u, file.Write(text, 5));
+    ASSERT_EQ(true, file.Insert(0, text, 1));
+    ASSERT_EQ(true, file.IsModified());
+
+    // The overlay cannot be disabled with unsaved changes
+    ASSERT_EQ(false, file.DisableOverlay());
+    ASSERT_EQ(true, file.Save());
+    ASSERT_EQ(true, file.DisableOverlay());
+
+    // Overwrites are written via the write-back buffer again
+    ASSERT_EQ(1u, file.WriteAt(text + 4, 1, 0));
+    ASSERT_EQ(false, file.IsModified());
+    ASSERT_EQ(true, file.IsDirty());
+    ASSERT_EQ(6u, file.ReadAt(buffer, 8, 0));
+    ASSERT_EQ(0, memcmp(buffer, "oHello", 6));
+    file.Close();
+
+    // Delete test file
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, Overlay)
+{
+    unsigned char buffer[32] = {};
+    uint32_t available = 0;
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    const auto space = static_cast<int64_t>(2 * HE_FILE_SAVE_BLOCK_SIZE + 3);
+
+    // Check the overlay with and without caching
+    for (int32_t use_cache = 0; use_cache <= 1; use_cache++)
+    {
+        TFile file(file_name, (use_cache != 0));
+        TFile check_file(file_name, false);
+
+        // Create the file
+        ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+        ASSERT_EQ(16u, file.Write(reinterpret_cast<unsigned char*>("0123456789ABCDEF"), 16));
+        ASSERT_EQ(true, file.Open(TFileMode::READWRITE));
+        ASSERT_EQ(true, file.EnableOverlay());
+        ASSERT_EQ(false, file.IsModified());
+
+        // Collect the changes
+        ASSERT_EQ(2u, file.WriteAt(reinterpret_cast<unsigned char*>("xy"), 2, 2));
+        ASSERT_EQ(true, file.Insert(4, reinterpret_cast<unsigned char*>("INS"), 3));
+        ASSERT_EQ(true, file.Erase(10, 2));
+        ASSERT_EQ(true, file.IsModified());
+        ASSERT_EQ(17, file.FileSize());
+        ASSERT_EQ(17u, file.ReadAt(buffer, sizeof(buffer), 0));
+        ASSERT_EQ(0, memcmp(buffer, "01xyINS4569ABCDEF", 17));
+
+        // Views refer to the pieces
+        auto view = file.Peek(4, 3, available);
+        ASSERT_EQ(3u, available);
+        ASSERT_EQ(0, memcmp(view, "INS", 3));
+        view = file.Peek(9, 8, available);
+        ASSERT_EQ(8u, available);
+        ASSERT_EQ(0, memcmp(view, "69ABCDEF", 8));
+
+        // The file itself is not changed yet
+        ASSERT_EQ(true, check_file.Open(TFileMode::READ));
+        ASSERT_EQ(16, check_file.FileSize());
+        ASSERT_EQ(16u, check_file.ReadAt(buffer, 16, 0));
+        ASSERT_EQ(0, memcmp(buffer, "0123456789ABCDEF", 16));
+        check_file.Close();
+
+        // Save the changes
+        ASSERT_EQ(true, file.Save());
+        ASSERT_EQ(false, file.IsModified());
+        ASSERT_EQ(true, check_file.Open(TFileMode::READ));
+        ASSERT_EQ(17, check_file.FileSize());
+        ASSERT_EQ(17u, check_file.ReadAt(buffer, sizeof(buffer), 0));
+        ASSERT_EQ(0, memcmp(buffer, "01xyINS4569ABCDEF", 17));
+        check_file.Close();
+
+        // Inserted zeros move the data by multiple blocks and are reported as hole
+        int64_t extent_start = 0;
+        int64_t extent_end = 0;
+        ASSERT_EQ(true, file.Insert(1, nullptr, space));
+        ASSERT_EQ(true, file.GetExtent(100, extent_start, extent_end));
+        ASSERT_EQ(1, extent_start);
+        ASSERT_EQ(1 + space, extent_end);
+        ASSERT_EQ(true, file.Save());
+        ASSERT_EQ(17 + space, file.FileSize());
+        ASSERT_EQ(3u, file.ReadAt(buffer, 3, space - 1));
+        ASSERT_EQ(0, memcmp(buffer, "\0\0" "1", 3));
+        ASSERT_EQ(16u, file.ReadAt(buffer, 16, space + 1));
+        ASSERT_EQ(0, memcmp(buffer, "1xyINS4569ABCDEF", 16));
+
+        // Erased data moves the data back and truncates the file
+        ASSERT_EQ(true, file.Erase(0, space));
+        ASSERT_EQ(true, file.Save());
+        ASSERT_EQ(true, check_file.Open(TFileMode::READ));
+        ASSERT_EQ(17, check_file.FileSize());
+        ASSERT_EQ(17u, check_file.ReadAt(buffer, sizeof(buffer), 0));
+        ASSERT_EQ(0, memcmp(buffer, "\0" "1xyINS4569ABCDEF", 17));
+        check_file.Close();
+
+        // Unsaved changes are dropped when the file is closed
+        ASSERT_EQ(true, file.Erase(0, 10));
+        file.Close();
+        ASSERT_EQ(true, file.Open(TFileMode::READ));
+        ASSERT_EQ(false, file.EnableOverlay());
+        ASSERT_EQ(17, file.FileSize());
+        file.Close();
+
+        // Delete test file
+        ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+    }
+}
+
+TEST(TFile, CopyTo)
+{
+    unsigned char buffer[32] = {};
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TString target_name = TestDataFactory::GetFilesDir() + "test2.dat";
+    TFile file(file_name, true);
+    TFile target(target_name, true);
+
+    // Create the source file with a block behind the first megabyte, and the target file
+    std::vector<unsigned char> data(HE_FILE_SAVE_BLOCK_SIZE + 16, 0x5A);
+    memcpy(&data[HE_FILE_SAVE_BLOCK_SIZE], "0123456789ABCDEF", 16);
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(static_cast<uint32_t>(data.size()), file.Write(data.data(), static_cast<uint32_t>(data.size())));
+    ASSERT_EQ(true, target.Open(TFileMode::CREATE));
+
+    // Copy the file data (within the kernel, if supported), the target sees the new content
+    ASSERT_EQ(1u, target.WriteAt(reinterpret_cast<unsigned char*>("X"), 1, 0));
+    ASSERT_EQ(static_cast<int64_t>(data.size()), file.CopyTo(&target, 0, static_cast<int64_t>(data.size()), 0));
+    ASSERT_EQ(static_cast<int64_t>(data.size()), target.FileSize());
+    ASSERT_EQ(16u, target.ReadAt(buffer, 16, HE_FILE_SAVE_BLOCK_SIZE));
+    ASSERT_EQ(0, memcmp(buffer, "0123456789ABCDEF", 16));
+
+    // Changes of the overlay are copied via a buffer, the rest is stopped by the end of the file
+    ASSERT_EQ(true, file.Insert(HE_FILE_SAVE_BLOCK_SIZE + 4, reinterpret_cast<unsigned char*>("xyz"), 3));
+    ASSERT_EQ(19, file.CopyTo(&target, HE_FILE_SAVE_BLOCK_SIZE, 32, 1));
+    ASSERT_EQ(20u, target.ReadAt(buffer, 20, 0));
+    ASSERT_EQ(0, memcmp(buffer, "Z0123xyz456789ABCDEF", 20));
+
+    // A target with unsaved changes is rejected
+    ASSERT_EQ(true, target.Erase(0, 1));
+    ASSERT_EQ(0, file.CopyTo(&target, 0, 1, 0));
+
+    // Delete test files
+    file.Close();
+    target.Close();
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+    ASSERT_EQ(0, _unlink(target_name.ToString())) << "Delete failed for <" << target_name.ToString() << ">";
+}
+
+/**
+ * @brief The progress receiver that records the reported progress.
+ */
+class TTestFileProgress : public TFileProgress
+{
+public:
+    int64_t calls_ = 0;
+    int64_t bytes_done_ = 0;
+    int64_t bytes_total_ = 0;
+public:
+    void Progress(int64_t bytes_done, int64_t bytes_total) noexcept override
+    {
+        this->calls_++;
+        this->bytes_done_ = bytes_done;
+        this->bytes_total_ = bytes_total;
+    }
+};
+
+TEST(TFile, InsertBlocks)
+{
+    unsigned char buffer[16] = {};
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, true);
+    TFile check_file(file_name, false);
+    TTestFileProgress progress;
+
+    // Create a file of four blocks, each block filled with its number
+    const int64_t block_size = 65536;
+    std::vector<unsigned char> data(static_cast<std::size_t>(4 * block_size));
+    for (std::size_t i = 0; i < data.size(); i++) data[i] = static_cast<unsigned char>('0' + (i / block_size));
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(static_cast<uint32_t>(data.size()), file.Write(data.data(), static_cast<uint32_t>(data.size())));
+    ASSERT_EQ(true, file.Open(TFileMode::READWRITE));
+
+    // Insert a whole block at a block boundary (a range is inserted, if supported) and a few bytes within the last block
+    std::vector<unsigned char> block(static_cast<std::size_t>(block_size), 'A');
+    ASSERT_EQ(true, file.Insert(block_size, block.data(), block_size));
+    ASSERT_EQ(true, file.Insert(4 * block_size + 16, reinterpret_cast<unsigned char*>("xyz"), 3));
+    ASSERT_EQ(true, file.Save(&progress));
+
+    // The progress is reported up to the total
+    ASSERT_LT(1, progress.calls_);
+    ASSERT_LT(block_size + 2, progress.bytes_total_);
+    ASSERT_EQ(progress.bytes_total_, progress.bytes_done_);
+
+    // The data is moved
+    ASSERT_EQ(true, check_file.Open(TFileMode::READ));
+    ASSERT_EQ(5 * block_size + 3, check_file.FileSize());
+    ASSERT_EQ(2u, check_file.ReadAt(buffer, 2, block_size - 1));
+    ASSERT_EQ(0, memcmp(buffer, "0A", 2));
+    ASSERT_EQ(2u, check_file.ReadAt(buffer, 2, 2 * block_size - 1));
+    ASSERT_EQ(0, memcmp(buffer, "A1", 2));
+    ASSERT_EQ(5u, check_file.ReadAt(buffer, 5, 4 * block_size + 15));
+    ASSERT_EQ(0, memcmp(buffer, "3xyz3", 5));
+    ASSERT_EQ(1u, check_file.ReadAt(buffer, 1, 5 * block_size + 2));
+    ASSERT_EQ('3', buffer[0]);
+    check_file.Close();
+
+    // Delete test file
+    file.Close();
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, EraseBlocks)
+{
+    unsigned char buffer[16] = {};
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TFile file(file_name, true);
+    TFile check_file(file_name, false);
+    TTestFileProgress progress;
+
+    // Create a file of four blocks, each block filled with its number
+    const int64_t block_size = 65536;
+    std::vector<unsigned char> data(static_cast<std::size_t>(4 * block_size));
+    for (std::size_t i = 0; i < data.size(); i++) data[i] = static_cast<unsigned char>('0' + (i / block_size));
+    data[static_cast<std::size_t>(3 * block_size + 16)] = 'x';
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(static_cast<uint32_t>(data.size()), file.Write(data.data(), static_cast<uint32_t>(data.size())));
+    ASSERT_EQ(true, file.Open(TFileMode::READWRITE));
+
+    // Erase a whole block at a block boundary (the range is collapsed, if supported) and a few bytes within the last block
+    ASSERT_EQ(true, file.Erase(block_size, block_size));
+    ASSERT_EQ(true, file.Erase(2 * block_size + 13, 3));
+    ASSERT_EQ(true, file.Save(&progress));
+    ASSERT_EQ(progress.bytes_total_, progress.bytes_done_);
+
+    // The data is moved and the file is truncated
+    ASSERT_EQ(true, check_file.Open(TFileMode::READ));
+    ASSERT_EQ(3 * block_size - 3, check_file.FileSize());
+    ASSERT_EQ(2u, check_file.ReadAt(buffer, 2, block_size - 1));
+    ASSERT_EQ(0, memcmp(buffer, "02", 2));
+    ASSERT_EQ(3u, check_file.ReadAt(buffer, 3, 2 * block_size + 12));
+    ASSERT_EQ(0, memcmp(buffer, "3x3", 3));
+    ASSERT_EQ(1u, check_file.ReadAt(buffer, 1, 3 * block_size - 4));
+    ASSERT_EQ('3', buffer[0]);
+    check_file.Close();
+
+    // Delete test file
+    file.Close();
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}
+
+TEST(TFile, Fill)
+{
+    unsigned char buffer[16] = {};
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TTestFileProgress progress;
+    const int64_t length = 3 * HE_FILE_SAVE_BLOCK_SIZE + 5;
+
+    // Fill with and without overlay
+    for (int32_t use_overlay = 0; use_overlay <= 1; use_overlay++)
+    {
+        TFile file(file_name, true);
+        TFile check_file(file_name, false);
+
+        // Create the file
+        std::vector<unsigned char> data(static_cast<std::size_t>(length + 8), 'x');
+        ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+        ASSERT_EQ(static_cast<uint32_t>(data.size()), file.Write(data.data(), static_cast<uint32_t>(data.size())));
+        ASSERT_EQ(true, file.Open(TFileMode::READWRITE));
+        if (use_overlay != 0) ASSERT_EQ(true, file.EnableOverlay());
+
+        // The pattern continues across the blocks, the last copy is truncated
+        ASSERT_EQ(true, file.Fill(4, reinterpret_cast<const unsigned char*>("abc"), 3, length, &progress));
+        ASSERT_EQ(progress.bytes_total_, progress.bytes_done_);
+        ASSERT_EQ(true, file.Save());
+        ASSERT_EQ(true, check_file.Open(TFileMode::READ));
+        ASSERT_EQ(length + 8, check_file.FileSize());
+        ASSERT_EQ(8u, check_file.ReadAt(buffer, 8, 0));
+        ASSERT_EQ(0, memcmp(buffer, "xxxxabca", 8));
+        ASSERT_EQ(6u, check_file.ReadAt(buffer, 6, HE_FILE_SAVE_BLOCK_SIZE + 1));
+        ASSERT_EQ(0, memcmp(buffer, "bcabca", 6));
+        ASSERT_EQ(6u, check_file.ReadAt(buffer, 6, length + 1));
+        ASSERT_EQ(0, memcmp(buffer, "cabxxx", 6));
+        check_file.Close();
+
+        // Zeros are written (or punched out of the file)
+        ASSERT_EQ(true, file.Fill(2, reinterpret_cast<const unsigned char*>("\0\0"), 2, length));
+        ASSERT_EQ(true, file.Save());
+        ASSERT_EQ(true, check_file.Open(TFileMode::READ));
+        ASSERT_EQ(4u, check_file.ReadAt(buffer, 4, 0));
+        ASSERT_EQ(0, memcmp(buffer, "xx\0\0", 4));
+        ASSERT_EQ(4u, check_file.ReadAt(buffer, 4, length));
+        ASSERT_EQ(0, memcmp(buffer, "\0\0" "ab", 4));
+        check_file.Close();
+
+        // Delete test file
+        file.Close();
+        ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+    }
+}
+
+TEST(TFile, SaveAs)
+{
+    unsigned char buffer[32] = {};
+    TString file_name = TestDataFactory::GetFilesDir() + "test.dat";
+    TString target_name = TestDataFactory::GetFilesDir() + "test2.dat";
+    TFile file(file_name, true, true);
+    TFile check_file(file_name, false);
+    TTestFileProgress progress;
+
+    // Create the file with a block behind the first megabyte
+    std::vector<unsigned char> data(HE_FILE_SAVE_BLOCK_SIZE + 16, 0x5A);
+    memcpy(&data[HE_FILE_SAVE_BLOCK_SIZE], "0123456789ABCDEF", 16);
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(static_cast<uint32_t>(data.size()), file.Write(data.data(), static_cast<uint32_t>(data.size())));
+    ASSERT_EQ(true, file.Open(TFileMode::READWRITE));
+    ASSERT_EQ(true, file.EnableOverlay());
+
+    // Change the content, the file cannot be saved onto itself
+    ASSERT_EQ(true, file.Insert(HE_FILE_SAVE_BLOCK_SIZE + 4, reinterpret_cast<const unsigned char*>("xyz"), 3));
+    ASSERT_EQ(true, file.Erase(0, 2));
+    ASSERT_EQ(true, file.Insert(HE_FILE_SAVE_BLOCK_SIZE + 17, nullptr, HE_FILE_CACHE_PAGE_SIZE));
+    const auto size = static_cast<int64_t>(data.size()) + 1 + HE_FILE_CACHE_PAGE_SIZE;
+    ASSERT_EQ(size, file.FileSize());
+    ASSERT_EQ(false, file.SaveAs(file_name));
+
+    // A file that is open in another file object cannot be overwritten
+    {
+        TFile other_file(target_name, true);
+        ASSERT_EQ(true, other_file.Open(TFileMode::CREATE));
+        ASSERT_EQ(false, file.SaveAs(target_name));
+        ASSERT_EQ(true, file.IsModified());
+    }
+
+    // The content is written to the new file
+    ASSERT_EQ(true, file.SaveAs(target_name, &progress));
+    ASSERT_EQ(size, progress.bytes_total_);
+    ASSERT_EQ(size, progress.bytes_done_);
+    ASSERT_EQ(false, file.IsModified());
+    ASSERT_EQ(size, file.FileSize());
+    ASSERT_EQ(19u, file.ReadAt(buffer, 19, HE_FILE_SAVE_BLOCK_SIZE - 2));
+    ASSERT_EQ(0, memcmp(buffer, "0123xyz456789ABCDEF", 19));
+    ASSERT_EQ(2u, file.ReadAt(buffer, 2, size - 2));
+    ASSERT_EQ(0, memcmp(buffer, "\0\0", 2));
+
+    // The old file is unchanged
+    ASSERT_EQ(true, check_file.Open(TFileMode::READ));
+    ASSERT_EQ(static_cast<int64_t>(data.size()), check_file.FileSize());
+    ASSERT_EQ(4u, check_file.ReadAt(buffer, 4, 0));
+    ASSERT_EQ(0, memcmp(buffer, "ZZZZ", 4));
+    check_file.Close();
+
+    // The following changes are saved to the new file
+    ASSERT_EQ(1u, file.WriteAt(reinterpret_cast<const unsigned char*>("!"), 1, 0));
+    ASSERT_EQ(true, file.Save());
+    TFile check_target(target_name, false);
+    ASSERT_EQ(true, check_target.Open(TFileMode::READ));
+    ASSERT_EQ(size, check_target.FileSize());
+    ASSERT_EQ(2u, check_target.ReadAt(buffer, 2, 0));
+    ASSERT_EQ(0, memcmp(buffer, "!Z", 2));
+    check_target.Close();
+
+    // Delete test files
+    file.Close();
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+    ASSERT_EQ(0, _unlink(target_name.ToString())) << "Delete failed for <" << target_name.ToString() << ">";
+}
@@ -1,10 +1,13 @@
-// Copyright(C) 2021 Roxxorfreak
-// Default header file for unit tests
-
-#pragma once
-
-#include "gtest/gtest.h"
-#include "headers.hpp"
-#include "_new_operator.hpp"
-#include "_test_data_factory.hpp"
-#include "_disassembler_runner.hpp"
+// Copyright(C) 2021 Roxxorfreak
+// Default header file for unit tests
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <future>
+#include "gtest/gtest.h"
+#include "headers.hpp"
+#include "_new_operator.hpp"
+#include "_test_data_factory.hpp"
+#include "_disassembler_runner.hpp"
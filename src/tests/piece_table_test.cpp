@@ -0,0 +1,151 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers_test.hpp"
+
+TEST(TPieceTable, InsertEraseReplace)
+{
+    TPieceTable table;
+    TPiece piece = {};
+    int64_t piece_start = 0;
+
+    // A new table covers the file with a single piece
+    ASSERT_EQ(true, table.Reset(100));
+    ASSERT_EQ(100, table.Size());
+    ASSERT_EQ(1u, table.GetPieceCount());
+    ASSERT_EQ(false, table.IsModified());
+
+    // Insert in the middle of the file splits the piece
+    ASSERT_EQ(true, table.Insert(10, reinterpret_cast<const unsigned char*>("ABC"), 3));
+    ASSERT_EQ(103, table.Size());
+    ASSERT_EQ(3u, table.GetPieceCount());
+    ASSERT_EQ(true, table.IsModified());
+    ASSERT_EQ(true, table.Find(11, piece, piece_start));
+    ASSERT_EQ(TPieceSource::ADDED, piece.source);
+    ASSERT_EQ(10, piece_start);
+    ASSERT_EQ(0, memcmp(table.GetAddedData(piece.offset), "ABC", 3));
+    ASSERT_EQ(true, table.Find(13, piece, piece_start));
+    ASSERT_EQ(TPieceSource::FILE, piece.source);
+    ASSERT_EQ(13, piece_start);
+    ASSERT_EQ(10, piece.offset);
+    ASSERT_EQ(90, piece.length);
+
+    // Data that follows the last added data extends the piece
+    ASSERT_EQ(true, table.Insert(13, reinterpret_cast<const unsigned char*>("D"), 1));
+    ASSERT_EQ(3u, table.GetPieceCount());
+    ASSERT_EQ(true, table.Find(10, piece, piece_start));
+    ASSERT_EQ(4, piece.length);
+
+    // Erase across the pieces (the file pieces are shortened)
+    ASSERT_EQ(true, table.Erase(5, 10));
+    ASSERT_EQ(94, table.Size());
+    ASSERT_EQ(2u, table.GetPieceCount());
+    ASSERT_EQ(true, table.Find(5, piece, piece_start));
+    ASSERT_EQ(TPieceSource::FILE, piece.source);
+    ASSERT_EQ(11, piece.offset);
+
+    // Replace behind the end fills the gap with zeros
+    ASSERT_EQ(true, table.Replace(96, reinterpret_cast<const unsigned char*>("XY"), 2));
+    ASSERT_EQ(98, table.Size());
+    ASSERT_EQ(true, table.Find(94, piece, piece_start));
+    ASSERT_EQ(TPieceSource::ZERO, piece.source);
+    ASSERT_EQ(2, piece.length);
+
+    // The pieces are returned in order
+    const auto pieces = table.GetPieces();
+    ASSERT_EQ(4u, pieces.size());
+    int64_t size = 0;
+    for (const auto& item : pieces) size += item.length;
+    ASSERT_EQ(98, size);
+
+    // Invalid ranges are rejected
+    ASSERT_EQ(false, table.Insert(99, nullptr, 1));
+    ASSERT_EQ(false, table.Erase(-1, 1));
+    ASSERT_EQ(false, table.Find(98, piece, piece_start));
+
+    // Reset drops the changes
+    ASSERT_EQ(true, table.Reset(0));
+    ASSERT_EQ(0, table.Size());
+    ASSERT_EQ(0u, table.GetPieceCount());
+}
+
+TEST(TPieceTable, Fill)
+{
+    TPieceTable table;
+    TPiece piece = {};
+    int64_t piece_start = 0;
+
+    // Fill a large range with a short buffer, each copy refers to the same data
+    ASSERT_EQ(true, table.Reset(100));
+    ASSERT_EQ(true, table.Fill(10, reinterpret_cast<const unsigned char*>("ABCD"), 4, 50));
+    ASSERT_EQ(100, table.Size());
+    ASSERT_EQ(15u, table.GetPieceCount());
+    ASSERT_EQ(true, table.Find(58, piece, piece_start));
+    ASSERT_EQ(TPieceSource::ADDED, piece.source);
+    ASSERT_EQ(58, piece_start);
+    ASSERT_EQ(2, piece.length);
+    ASSERT_EQ(0, memcmp(table.GetAddedData(piece.offset), "AB", 2));
+    ASSERT_EQ(true, table.Find(30, piece, piece_start));
+    ASSERT_EQ(0, piece.offset);
+
+    // A fill behind the end extends the content, zeros are a single piece
+    ASSERT_EQ(true, table.Fill(98, reinterpret_cast<const unsigned char*>("XY"), 2, 4));
+    ASSERT_EQ(102, table.Size());
+    ASSERT_EQ(true, table.Fill(0, nullptr, 0, 30));
+    ASSERT_EQ(true, table.Find(29, piece, piece_start));
+    ASSERT_EQ(TPieceSource::ZERO, piece.source);
+    ASSERT_EQ(0, piece_start);
+
+    // Invalid buffers are rejected
+    ASSERT_EQ(false, table.Fill(0, reinterpret_cast<const unsigned char*>("XY"), 0, 4));
+    ASSERT_EQ(false, table.Fill(-1, reinterpret_cast<const unsigned char*>("XY"), 2, 4));
+}
+
+TEST(TPieceTable, ManyChanges)
+{
+    TPieceTable table;
+    std::vector<unsigned char> content(4096);
+    std::vector<unsigned char> expected(4096);
+    TPiece piece = {};
+    int64_t piece_start = 0;
+    uint32_t seed = 12345;
+
+    // Mark the original content by its offset
+    for (std::size_t i = 0; i < content.size(); i++) content[i] = static_cast<unsigned char>(i % 251);
+    expected = content;
+    ASSERT_EQ(true, table.Reset(static_cast<int64_t>(content.size())));
+
+    // Apply random changes to both the table and a plain copy
+    for (int32_t i = 0; i < 2000; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        const auto position = static_cast<int64_t>((seed >> 8) % (expected.size() + 1));
+        const auto length = static_cast<int64_t>((seed >> 4) % 16);
+        const unsigned char value[16] = { static_cast<unsigned char>(i), static_cast<unsigned char>(i), static_cast<unsigned char>(i), static_cast<unsigned char>(i), static_cast<unsigned char>(i), static_cast<unsigned char>(i), static_cast<unsigned char>(i), static_cast<unsigned char>(i), static_cast<unsigned char>(i), static_cast<unsigned char>(i), static_cast<unsigned char>(i), static_cast<unsigned char>(i), static_cast<unsigned char>(i), static_cast<unsigned char>(i), static_cast<unsigned char>(i), static_cast<unsigned char>(i) };
+        switch (seed % 3)
+        {
+            case 0:
+                ASSERT_EQ(true, table.Insert(position, value, length));
+                expected.insert(expected.begin() + position, value, value + length);
+                break;
+            case 1:
+                ASSERT_EQ(true, table.Erase(position, length));
+                expected.erase(expected.begin() + position, expected.begin() + hedit_min(position + length, static_cast<int64_t>(expected.size())));
+                break;
+            default:
+                ASSERT_EQ(true, table.Replace(position, value, length));
+                if (position + length > static_cast<int64_t>(expected.size())) expected.resize(static_cast<std::size_t>(position + length));
+                std::copy(value, value + length, expected.begin() + position);
+                break;
+        }
+        ASSERT_EQ(static_cast<int64_t>(expected.size()), table.Size());
+    }
+
+    // Compare the content byte by byte
+    for (int64_t i = 0; i < table.Size(); i++)
+    {
+        ASSERT_EQ(true, table.Find(i, piece, piece_start));
+        const auto offset = piece.offset + (i - piece_start);
+        const auto value = (piece.source == TPieceSource::FILE) ? content[static_cast<std::size_t>(offset)] : *table.GetAddedData(offset);
+        ASSERT_EQ(expected[static_cast<std::size_t>(i)], value) << "Position " << i;
+    }
+}
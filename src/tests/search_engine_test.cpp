@@ -0,0 +1,89 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers_test.hpp"
+
+TEST(TSearchEngine, Modes)
+{
+    int64_t match = 0;
+    TString file_name1 = TestDataFactory::GetFilesDir() + "test1.dat";
+    TString file_name2 = TestDataFactory::GetFilesDir() + "test2.dat";
+    TFile file1(file_name1, true);
+    TFile file2(file_name2, true);
+
+    // Create two files that differ in one byte, with a string across the first block boundary
+    std::vector<unsigned char> data(static_cast<std::size_t>(HE_SEARCH_BLOCK_SIZE) * 2 + 100, 0x20);
+    memcpy(&data[HE_SEARCH_BLOCK_SIZE - 2], "NeedLE", 6);
+    memcpy(&data[100], "needle", 6);
+    memcpy(&data[data.size() - 7], "needle", 6);
+    ASSERT_EQ(true, file1.Open(TFileMode::CREATE));
+    ASSERT_EQ(static_cast<uint32_t>(data.size()), file1.Write(data.data(), static_cast<uint32_t>(data.size())));
+    data[HE_SEARCH_BLOCK_SIZE + 5] = 0x21;
+    ASSERT_EQ(true, file2.Open(TFileMode::CREATE));
+    ASSERT_EQ(static_cast<uint32_t>(data.size()), file2.Write(data.data(), static_cast<uint32_t>(data.size())));
+
+    // Case sensitive text: the match is found in the block of its first byte, the string may continue behind the block
+    TSearchEngine text_cs(TSearchMode::TEXT_CS);
+    ASSERT_EQ(true, text_cs.AddFile(&file1, reinterpret_cast<const unsigned char*>("NeedLE"), 6));
+    ASSERT_EQ(6u, text_cs.WindowLength());
+    ASSERT_EQ(true, text_cs.Search(0, HE_SEARCH_BLOCK_SIZE, TSearchDirection::FORWARD, match));
+    ASSERT_EQ(HE_SEARCH_BLOCK_SIZE - 2, match);
+    ASSERT_EQ(false, text_cs.Search(HE_SEARCH_BLOCK_SIZE - 1, HE_SEARCH_BLOCK_SIZE, TSearchDirection::FORWARD, match));
+
+    // Case insensitive text, forward and backward
+    TSearchEngine text_ci(TSearchMode::TEXT_CI);
+    ASSERT_EQ(true, text_ci.AddFile(&file1, reinterpret_cast<const unsigned char*>("NEEDLE"), 6));
+    ASSERT_EQ(true, text_ci.Search(101, HE_SEARCH_BLOCK_SIZE, TSearchDirection::FORWARD, match));
+    ASSERT_EQ(HE_SEARCH_BLOCK_SIZE - 2, match);
+    ASSERT_EQ(true, text_ci.Search(HE_SEARCH_BLOCK_SIZE - 3, HE_SEARCH_BLOCK_SIZE - 2, TSearchDirection::BACKWARD, match));
+    ASSERT_EQ(100, match);
+
+    // A string at the end of the file is found, the positions behind it do not match
+    const auto last = static_cast<int64_t>(data.size()) - 1;
+    ASSERT_EQ(true, text_ci.Search(last, 200, TSearchDirection::BACKWARD, match));
+    ASSERT_EQ(last - 6, match);
+
+    // A string that ends with the last byte of the file is found at the last position
+    TSearchEngine text_end(TSearchMode::TEXT_CS);
+    ASSERT_EQ(true, text_end.AddFile(&file1, reinterpret_cast<const unsigned char*>("dle "), 4));
+    ASSERT_EQ(true, text_end.Search(last - 3, 1, TSearchDirection::FORWARD, match));
+    ASSERT_EQ(last - 3, match);
+    ASSERT_EQ(true, text_end.Search(last - 3, 200, TSearchDirection::BACKWARD, match));
+    ASSERT_EQ(last - 3, match);
+
+    // Count the matches
+    TSearchEngine counter(TSearchMode::COUNT);
+    ASSERT_EQ(true, counter.AddFile(&file1, reinterpret_cast<const unsigned char*>("needle"), 6));
+    for (int64_t position = 0; position <= last; position += HE_SEARCH_BLOCK_SIZE)
+    {
+        ASSERT_EQ(false, counter.Search(position, hedit_min(HE_SEARCH_BLOCK_SIZE, last + 1 - position), TSearchDirection::FORWARD, match));
+    }
+    ASSERT_EQ(2, counter.Counter());
+
+    // Hex range (a single byte)
+    const unsigned char range[2] = { 0x41, 0x5A };
+    TSearchEngine hex_range(TSearchMode::HEX_RANGE);
+    ASSERT_EQ(true, hex_range.AddFile(&file1, range, 2));
+    ASSERT_EQ(1u, hex_range.WindowLength());
+    ASSERT_EQ(true, hex_range.Search(HE_SEARCH_BLOCK_SIZE - 1, HE_SEARCH_BLOCK_SIZE, TSearchDirection::FORWARD, match));
+    ASSERT_EQ(HE_SEARCH_BLOCK_SIZE + 2, match);
+
+    // Any difference between the files
+    TSearchEngine difference(TSearchMode::ANY_DIFFERENCE);
+    ASSERT_EQ(true, difference.AddFile(&file1, nullptr, 0));
+    ASSERT_EQ(true, difference.AddFile(&file2, nullptr, 0));
+    ASSERT_EQ(true, difference.Search(0, HE_SEARCH_BLOCK_SIZE, TSearchDirection::FORWARD, match) || difference.Search(HE_SEARCH_BLOCK_SIZE, HE_SEARCH_BLOCK_SIZE, TSearchDirection::FORWARD, match));
+    ASSERT_EQ(HE_SEARCH_BLOCK_SIZE + 5, match);
+
+    // Probable word (the space does not belong to a word)
+    TSearchEngine word(TSearchMode::PROBABLE_WORD);
+    ASSERT_EQ(true, word.AddFile(&file1, nullptr, 0));
+    word.SetWordCharSet("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ", 6);
+    ASSERT_EQ(true, word.Search(HE_SEARCH_BLOCK_SIZE * 2 + 50, HE_SEARCH_BLOCK_SIZE, TSearchDirection::BACKWARD, match) || word.Search(HE_SEARCH_BLOCK_SIZE - 1, HE_SEARCH_BLOCK_SIZE, TSearchDirection::BACKWARD, match));
+    ASSERT_EQ(HE_SEARCH_BLOCK_SIZE - 2, match);
+
+    // Delete test files
+    file1.Close();
+    file2.Close();
+    ASSERT_EQ(0, _unlink(file_name1.ToString())) << "Delete failed for <" << file_name1.ToString() << ">";
+    ASSERT_EQ(0, _unlink(file_name2.ToString())) << "Delete failed for <" << file_name2.ToString() << ">";
+}
@@ -0,0 +1,243 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include <cctype>
+#include <random>
+#include "headers_test.hpp"
+
+/**
+ * Finds the first match by comparing the pattern at each position (the search before TSearchMatcher).
+ * @param data The data.
+ * @param start The first position to check.
+ * @param positions The number of positions.
+ * @param pattern The pattern.
+ * @return The position of the first match or the number of positions, if there is no match.
+ */
+static std::size_t FindNaive(const unsigned char* data, std::size_t start, std::size_t positions, const std::vector<unsigned char>& pattern)
+{
+    for (auto position = start; position < positions; position++)
+    {
+        if (memcmp(&data[position], pattern.data(), pattern.size()) == 0) return position;
+    }
+    return positions;
+}
+
+/**
+ * Finds the last match by comparing the pattern at each position, from the end.
+ * @param data The data.
+ * @param start The lowest position to check.
+ * @param positions The number of positions.
+ * @param pattern The pattern.
+ * @return The position of the last match or the number of positions, if there is no match.
+ */
+static std::size_t FindLastNaive(const unsigned char* data, std::size_t start, std::size_t positions, const std::vector<unsigned char>& pattern)
+{
+    for (auto position = positions; position > start; position--)
+    {
+        if (memcmp(&data[position - 1], pattern.data(), pattern.size()) == 0) return position - 1;
+    }
+    return positions;
+}
+
+/**
+ * Counts the matches of the pattern within the specified positions (via the matcher or, without matcher, via FindNaive()).
+ * @param data The data.
+ * @param positions The number of positions.
+ * @param pattern The pattern.
+ * @param matcher The prepared matcher or nullptr.
+ * @return The number of matches.
+ */
+static int64_t CountMatches(const unsigned char* data, std::size_t positions, const std::vector<unsigned char>& pattern, const TSearchMatcher* matcher)
+{
+    int64_t count = 0;
+    auto position = (matcher != nullptr) ? matcher->Find(data, 0, positions) : FindNaive(data, 0, positions, pattern);
+    while (position < positions)
+    {
+        count++;
+        position = (matcher != nullptr) ? matcher->Find(data, position + 1, positions) : FindNaive(data, position + 1, positions, pattern);
+    }
+    return count;
+}
+
+/**
+ * Counts the matches of the pattern within the specified positions from the end (via the matcher or, without matcher, via FindLastNaive()).
+ * @param data The data.
+ * @param positions The number of positions.
+ * @param pattern The pattern.
+ * @param matcher The prepared matcher or nullptr.
+ * @return The number of matches.
+ */
+static int64_t CountMatchesBackward(const unsigned char* data, std::size_t positions, const std::vector<unsigned char>& pattern, const TSearchMatcher* matcher)
+{
+    int64_t count = 0;
+    auto end = positions;
+    while (end > 0)
+    {
+        const auto position = (matcher != nullptr) ? matcher->FindLast(data, 0, end) : FindLastNaive(data, 0, end, pattern);
+        if (position >= end) break;
+        count++;
+        end = position;
+    }
+    return count;
+}
+
+/**
+ * Returns the implementations of the matcher that the processor supports.
+ * @return The implementations of the matcher.
+ */
+static std::vector<TSearchMatcherPath> SupportedPaths()
+{
+    std::vector<TSearchMatcherPath> paths = { TSearchMatcherPath::SCALAR, TSearchMatcherPath::HORSPOOL };
+    #if defined(HE_HAS_SSE2)
+    paths.push_back(TSearchMatcherPath::SSE2);
+    #endif
+    #if defined(HE_HAS_AVX2)
+    if (TSearchMatcher::DetectPath() == TSearchMatcherPath::AVX2) paths.push_back(TSearchMatcherPath::AVX2);
+    #endif
+    return paths;
+}
+
+TEST(TSearchMatcher, Find)
+{
+    std::mt19937 random(42);
+    TSearchMatcher matcher;
+
+    // An empty pattern is rejected
+    ASSERT_EQ(false, matcher.Prepare(nullptr, 0, false));
+
+    // Random data over a small alphabet (many partial matches) with patterns at the start and the end
+    for (auto length : { 1, 2, 3, 7, 16, 31, 32, 33, 100 })
+    {
+        std::vector<unsigned char> data(5000);
+        for (auto& value : data) value = static_cast<unsigned char>('a' + random() % 3);
+        std::vector<unsigned char> pattern(data.end() - length, data.end());
+        const auto positions = data.size() - pattern.size() + 1;
+        for (auto path : SupportedPaths())
+        {
+            ASSERT_EQ(true, matcher.Prepare(pattern.data(), pattern.size(), false, path));
+            ASSERT_EQ(static_cast<std::size_t>(length), matcher.Length());
+            for (std::size_t start = 0; start < positions; start += 1 + random() % 97)
+            {
+                ASSERT_EQ(FindNaive(data.data(), start, positions, pattern), matcher.Find(data.data(), start, positions)) << "Length " << length << ", path " << static_cast<int32_t>(path) << ", start " << start;
+                const auto end = start + random() % (positions - start + 1);
+                ASSERT_EQ(FindLastNaive(data.data(), start, end, pattern), matcher.FindLast(data.data(), start, end)) << "Length " << length << ", path " << static_cast<int32_t>(path) << ", start " << start << ", end " << end;
+            }
+            ASSERT_EQ(positions - 1, matcher.Find(data.data(), positions - 1, positions));
+            ASSERT_EQ(positions - 1, matcher.FindLast(data.data(), 0, positions));
+            ASSERT_EQ(positions, matcher.Find(data.data(), positions, positions));
+        }
+    }
+
+    // A binary pattern within zeros
+    const unsigned char binary[4] = { 0x00, 0xFF, 0x00, 0x80 };
+    std::vector<unsigned char> zeros(1000, 0x00);
+    for (auto path : SupportedPaths())
+    {
+        ASSERT_EQ(true, matcher.Prepare(binary, sizeof(binary), false, path));
+        ASSERT_EQ(zeros.size() - 3, matcher.Find(zeros.data(), 0, zeros.size() - 3));
+        memcpy(&zeros[500], binary, sizeof(binary));
+        ASSERT_EQ(500u, matcher.Find(zeros.data(), 0, zeros.size() - 3));
+        ASSERT_EQ(500u, matcher.FindLast(zeros.data(), 0, zeros.size() - 3));
+        ASSERT_EQ(zeros.size() - 3, matcher.FindLast(zeros.data(), 501, zeros.size() - 3));
+        memset(&zeros[500], 0, sizeof(binary));
+    }
+}
+
+TEST(TSearchMatcher, IgnoreCase)
+{
+    std::mt19937 random(7);
+    TSearchMatcher matcher;
+
+    // Random data of letters in both cases and their neighbours that differ in bit 0x20 only ('@'/'`', '['/'{')
+    const char* const alphabet = "aAbB@`[{";
+    for (auto length : { 1, 2, 5, 16, 40 })
+    {
+        std::vector<unsigned char> data(5000);
+        for (auto& value : data) value = static_cast<unsigned char>(alphabet[random() % 8]);
+        std::vector<unsigned char> pattern(static_cast<std::size_t>(length));
+        for (auto& value : pattern) value = static_cast<unsigned char>(alphabet[random() % 8]);
+        memcpy(&data[data.size() - pattern.size()], pattern.data(), pattern.size());
+        for (auto& value : pattern) value = static_cast<unsigned char>(isupper(value) ? tolower(value) : (islower(value) ? toupper(value) : value));
+        std::vector<unsigned char> lower_data(data);
+        std::vector<unsigned char> lower_pattern(pattern);
+        for (auto& value : lower_data) value = static_cast<unsigned char>(tolower(value));
+        for (auto& value : lower_pattern) value = static_cast<unsigned char>(tolower(value));
+        const auto positions = data.size() - pattern.size() + 1;
+        for (auto path : SupportedPaths())
+        {
+            ASSERT_EQ(true, matcher.Prepare(pattern.data(), pattern.size(), true, path));
+            for (std::size_t start = 0; start < positions; start += 1 + random() % 97)
+            {
+                ASSERT_EQ(FindNaive(lower_data.data(), start, positions, lower_pattern), matcher.Find(data.data(), start, positions)) << "Length " << length << ", path " << static_cast<int32_t>(path) << ", start " << start;
+                ASSERT_EQ(FindLastNaive(lower_data.data(), 0, start + 1, lower_pattern), matcher.FindLast(data.data(), 0, start + 1)) << "Length " << length << ", path " << static_cast<int32_t>(path) << ", end " << start + 1;
+            }
+        }
+    }
+
+    // Binary zeros and bytes above 0x7F match exactly (the data is not terminated by a zero)
+    const unsigned char pattern[4] = { 'a', 0x00, 0xE4, 'Z' };
+    const unsigned char data[12] = { 'A', 0x00, 0xC4, 'z', 'a', 0x00, 0x00, 'z', 'A', 0x00, 0xE4, 'z' };
+    for (auto path : SupportedPaths())
+    {
+        ASSERT_EQ(true, matcher.Prepare(pattern, sizeof(pattern), true, path));
+        ASSERT_EQ(8u, matcher.Find(data, 0, 9));
+        ASSERT_EQ(8u, matcher.FindLast(data, 0, 9));
+        ASSERT_EQ(false, matcher.Matches(&data[0]));
+        ASSERT_EQ(true, matcher.Matches(&data[8]));
+    }
+}
+
+TEST(TSearchMatcher, DISABLED_Benchmark)
+{
+    // Run via --gtest_also_run_disabled_tests: the throughput of each implementation on text-like data (all matches of a pattern that consists of the same characters are counted)
+    std::mt19937 random(1);
+    const char* const text = "the quick brown fox jumps over the lazy dog, 0123456789\n";
+    std::vector<unsigned char> data(static_cast<std::size_t>(HE_SEARCH_BLOCK_SIZE) * 16);
+    for (auto& value : data) value = static_cast<unsigned char>(text[random() % strlen(text)]);
+    for (auto length : { 1, 2, 4, 8, 16, 24, 32, 48, 64, 128 })
+    {
+        std::vector<unsigned char> pattern(static_cast<std::size_t>(length));
+        for (auto& value : pattern) value = static_cast<unsigned char>(text[random() % strlen(text)]);
+        const auto positions = data.size() - pattern.size() + 1;
+
+        // The per-position comparison
+        auto begin = std::chrono::steady_clock::now();
+        const auto expected = CountMatches(data.data(), positions, pattern, nullptr);
+        auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        printf("Length %3d, memcmp per position: %8.1f MB/s\n", length, static_cast<double>(data.size()) / 1048576.0 / seconds);
+
+        // The implementations of the matcher
+        TSearchMatcher matcher;
+        for (auto path : SupportedPaths())
+        {
+            ASSERT_EQ(true, matcher.Prepare(pattern.data(), pattern.size(), false, path));
+            begin = std::chrono::steady_clock::now();
+            const auto result = CountMatches(data.data(), positions, pattern, &matcher);
+            seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+            printf("Length %3d, path %d (%d):        %8.1f MB/s\n", length, static_cast<int32_t>(path), static_cast<int32_t>(matcher.Path()), static_cast<double>(data.size()) / 1048576.0 / seconds);
+            ASSERT_EQ(expected, result);
+
+            // The same implementation from the end (backward search)
+            begin = std::chrono::steady_clock::now();
+            const auto result_backward = CountMatchesBackward(data.data(), positions, pattern, &matcher);
+            seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+            printf("Length %3d, path %d (%d) backward: %8.1f MB/s\n", length, static_cast<int32_t>(path), static_cast<int32_t>(matcher.Path()), static_cast<double>(data.size()) / 1048576.0 / seconds);
+            ASSERT_EQ(expected, result_backward);
+        }
+
+        // Case insensitive: _strnicmp() per position and the fastest implementation of the matcher
+        begin = std::chrono::steady_clock::now();
+        int64_t expected_ci = 0;
+        for (std::size_t position = 0; position < positions; position++)
+        {
+            if (_strnicmp(reinterpret_cast<const char*>(pattern.data()), reinterpret_cast<const char*>(&data[position]), pattern.size()) == 0) expected_ci++;
+        }
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        printf("Length %3d, _strnicmp per position: %8.1f MB/s\n", length, static_cast<double>(data.size()) / 1048576.0 / seconds);
+        ASSERT_EQ(true, matcher.Prepare(pattern.data(), pattern.size(), true));
+        begin = std::chrono::steady_clock::now();
+        const auto result_ci = CountMatches(data.data(), positions, pattern, &matcher);
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        printf("Length %3d, ignoring case (%d):     %8.1f MB/s\n", length, static_cast<int32_t>(matcher.Path()), static_cast<double>(data.size()) / 1048576.0 / seconds);
+        ASSERT_EQ(expected_ci, result_ci);
+    }
+}
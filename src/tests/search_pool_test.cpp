@@ -0,0 +1,54 @@
+// Copyright (c) 2021 Roxxorfreak
+
+#include "headers_test.hpp"
+
+TEST(TSearchPool, FirstMatchInSearchOrder)
+{
+    int64_t match = 0;
+    TString file_name = TestDataFactory::GetFilesDir() + "test1.dat";
+    TFile file(file_name, true);
+
+    // Create a file of six blocks with matches in the second block, across the third and the fourth block and in the fifth block
+    std::vector<unsigned char> data(static_cast<std::size_t>(HE_SEARCH_BLOCK_SIZE) * 6, 0x20);
+    const int64_t needles[4] = { HE_SEARCH_BLOCK_SIZE + 10, HE_SEARCH_BLOCK_SIZE * 3 - 3, HE_SEARCH_BLOCK_SIZE * 4 + 7, HE_SEARCH_BLOCK_SIZE * 4 + 500 };
+    for (auto needle : needles) memcpy(&data[static_cast<std::size_t>(needle)], "needle", 6);
+    ASSERT_EQ(true, file.Open(TFileMode::CREATE));
+    ASSERT_EQ(static_cast<uint32_t>(data.size()), file.Write(data.data(), static_cast<uint32_t>(data.size())));
+
+    // Search forward and backward with four threads (the blocks behind the first match are skipped)
+    TSearchEngine engine(TSearchMode::TEXT_CS);
+    ASSERT_EQ(true, engine.AddFile(&file, reinterpret_cast<const unsigned char*>("needle"), 6));
+    TSearchPool pool(engine, 4);
+    ASSERT_EQ(HE_SEARCH_BLOCK_SIZE * 4, pool.Capacity());
+    for (int32_t i = 0; i < 20; i++)
+    {
+        ASSERT_EQ(true, pool.Search(0, pool.Capacity(), TSearchDirection::FORWARD, match));
+        ASSERT_EQ(needles[0], match);
+        ASSERT_EQ(true, pool.Search(needles[0] + 1, pool.Capacity(), TSearchDirection::FORWARD, match));
+        ASSERT_EQ(needles[1], match);
+        ASSERT_EQ(true, pool.Search(static_cast<int64_t>(data.size()) - 7, pool.Capacity(), TSearchDirection::BACKWARD, match));
+        ASSERT_EQ(needles[3], match);
+        ASSERT_EQ(true, pool.Search(needles[2] - 1, pool.Capacity(), TSearchDirection::BACKWARD, match));
+        ASSERT_EQ(needles[1], match);
+    }
+    ASSERT_EQ(false, pool.Search(needles[3] + 1, HE_SEARCH_BLOCK_SIZE, TSearchDirection::FORWARD, match));
+    ASSERT_EQ(false, pool.Search(0, pool.Capacity() + 1, TSearchDirection::FORWARD, match));
+
+    // Count with four threads and with a single thread (the counters of all threads are summed)
+    const auto positions = static_cast<int64_t>(data.size()) - 6;
+    for (auto threads : { 4, 1 })
+    {
+        TSearchEngine counter(TSearchMode::COUNT);
+        ASSERT_EQ(true, counter.AddFile(&file, reinterpret_cast<const unsigned char*>("needle"), 6));
+        TSearchPool count_pool(counter, threads);
+        for (int64_t position = 0; position < positions; position += count_pool.Capacity())
+        {
+            ASSERT_EQ(false, count_pool.Search(position, hedit_min(count_pool.Capacity(), positions - position), TSearchDirection::FORWARD, match));
+        }
+        ASSERT_EQ(4, count_pool.Counter());
+    }
+
+    // Delete test file
+    file.Close();
+    ASSERT_EQ(0, _unlink(file_name.ToString())) << "Delete failed for <" << file_name.ToString() << ">";
+}